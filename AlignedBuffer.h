@@ -0,0 +1,63 @@
+/*
+  Filename:   AlignedBuffer.h
+  Author:     Raymond Hummel
+  Date:       5/14/2014
+  Purpose:    Contains the definition and implementation of the cache-line
+              aligned array allocation used by the matrix classes
+*/
+
+#ifndef ALIGNEDBUFFER_H
+#define ALIGNEDBUFFER_H
+
+#include <cstddef>
+#include <new>
+
+
+// bytes in a cache line, every buffer starts on one of these boundaries
+const size_t CACHE_LINE_SIZE = 64;
+
+
+/*  Description: Aligned New, allocates an array that starts on a cache line
+    Preconditions: n >= 0
+                   T must have a defined default constructor
+    Postconditions: returns a pointer to n default constructed elements,
+                    the pointer must be released with alignedDelete
+*/
+template<class T>
+T* alignedNew(size_t n)
+{
+  if(n == 0) return NULL;
+  // room for the elements, the worst case padding, and the raw pointer
+  size_t bytes = n*sizeof(T) + CACHE_LINE_SIZE + sizeof(void*);
+  char* raw = static_cast<char*>(::operator new(bytes));
+  size_t address = reinterpret_cast<size_t>(raw + sizeof(void*));
+  size_t padding = (CACHE_LINE_SIZE - address%CACHE_LINE_SIZE) % CACHE_LINE_SIZE;
+  char* aligned = raw + sizeof(void*) + padding;
+  // remember where the block really starts, just in front of the elements
+  reinterpret_cast<void**>(aligned)[-1] = raw;
+  T* head = reinterpret_cast<T*>(aligned);
+  for(size_t i=0; i < n; i++)
+  {
+    new (head + i) T();
+  }
+  return head;
+}
+
+
+/*  Description: Aligned Delete, releases an array from alignedNew
+    Preconditions: head came from alignedNew(n) or is NULL
+    Postconditions: all n elements are destroyed and the memory is freed
+*/
+template<class T>
+void alignedDelete(T* head, size_t n)
+{
+  if(head == NULL) return;
+  for(size_t i=n; i > 0; i--)
+  {
+    head[i-1].~T();
+  }
+  ::operator delete(reinterpret_cast<void**>(head)[-1]);
+}
+
+
+#endif
\ No newline at end of file
@@ -0,0 +1,262 @@
+/*
+  Filename:   BandedSymmetricMatrix.h
+  Author:     Raymond Hummel
+  Date:       5/13/2014
+  Purpose:    Contains the declaration of the BandedSymmetricMatrix class
+*/
+
+#ifndef BANDEDSYMMETRICMATRIX_H
+#define BANDEDSYMMETRICMATRIX_H
+
+#include "MatrixBase.h"
+
+
+/*
+Only the upper band is stored, row i holds the elements (i,i) through
+(i,i+bandwidth), so the storage is numRows*(bandwidth+1) elements in
+a single Vector. Elements outside of the band are zero.
+*/
+template<class T>
+class BandedSymmetricMatrix: public virtual MatrixBase<T>
+{
+  public:
+    /*  Description: Default Constructor, creates empty BandedSymmetricMatrix
+        Preconditions: None
+        Postconditions: numRows, numCols, halfBandwidth all equal 0
+    */
+    BandedSymmetricMatrix():numRows(0), halfBandwidth(0), zero(0) {}
+    
+    
+    /*  Description: Pre-Sized Constructor, creates BandedSymmetricMatrix of
+                     size n by n with the given bandwidth
+        Preconditions: n must be a positive, non-zero integer
+                       0 <= bandwidth < n
+        Postconditions: numRows = n, numCols = n, every element in the band
+                        is set by the default constructor for T
+                        throws a SizeError exception if n < 0 or bandwidth
+                        is out of range
+    */
+    BandedSymmetricMatrix(int n, int bandwidth);
+    
+    
+    /*  Description: Base Constructor, stores the band of a symmetric matrix
+        Preconditions: original must be symmetric
+        Postconditions: calling object is a deep copy of original with the
+                        smallest bandwidth that holds its nonzeros
+                        throws if original is not symmetric
+    */
+    explicit BandedSymmetricMatrix(const MatrixBase<T>& original);
+    
+    
+    /*  Description: Matrix Subscripting Operator, provides access to
+                     elements of the matrix
+        Preconditions: row, col are positive integers between
+                       0 and numRows or numCols respectively
+                       calling object is not const
+        Postconditions: returns a reference to the element at row, col,
+                        the band is first widened to |row-col| if needed,
+                        which costs O(numRows*bandwidth)
+                        throws a RangeError if row,col < 0 or row >= numRows
+                        or col >= numCols
+    */
+    virtual T& operator()(int row, int col);
+    
+    
+    /*  Description: const Matrix Subscripting Operator, provides read-only
+                     access to elements of the matrix
+        Preconditions: row, col are positive integers between
+                       0 and numRows or numCols respectively
+        Postconditions: returns a const reference to the element at row, col
+                        or to zero if the element is outside the band
+                        throws a RangeError if row,col < 0 or row >= numRows
+                        or col >= numCols
+    */
+    virtual const T& operator()(int row, int col) const;
+    
+    
+    /*  Description: Matrix Addition, adds matrices
+        Preconditions: T must have a defined addition operator
+                       rhs must be symmetric
+        Postconditions: returns matrix that is element-wise
+                        sum of calling object and rhs, the band is widened
+                        to hold every nonzero of rhs,
+                        throws a SizeError if rhs has a different number
+                        of rows or columns
+    */
+    virtual MatrixBase<T>& operator+=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Matrix Subtraction, subtracts matrices
+        Preconditions: T must have a defined subtraction operator
+                       rhs must be symmetric
+        Postconditions: returns matrix that is element-wise
+                        difference of calling object and rhs, the band is
+                        widened to hold every nonzero of rhs,
+                        throws a SizeError if rhs has a different number
+                        of rows or columns
+    */
+    virtual MatrixBase<T>& operator-=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Scalar Multiplication, multiplies all elements of the
+                     matrix by the parameter value
+        Preconditions: T must have a defined multiplication operator
+        Postconditions: returns matrix with every element containing the
+                        calling object's element multiplied by rhs
+    */
+    virtual MatrixBase<T>& operator*=(const T& rhs);
+    
+    
+    /*  Description: Matrix Multiplication, performs matrix multiplication and
+                     returns the result
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+                       rhs must be symmetric
+        Postconditions: returns the upper band of the product, the band
+                        grows by the bandwidth of rhs
+                        throws SizeError if numCol != rhs.numRows
+    */
+    virtual MatrixBase<T>& operator*=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Vector Multiplication, multiplies the matrix by a vector
+                     and returns the resulting vector in O(numRows*bandwidth)
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+        Postconditions: returns vector multiplication product with
+                        size = numRows x 1
+                        throws SizeError if numCol != rhs.numRows
+    */
+    virtual Vector<T> operator*(const Vector<T>& rhs) const;
+    
+    
+    /*  Description: Getter for the columns of calling object
+        Preconditions: None
+        Postconditions: returns the column referenced by colIndex
+    */
+    virtual Vector<T> getColumn(int colIndex) const;
+    
+    
+    /*  Description: Getter for the rows of calling object
+        Preconditions: None
+        Postconditions: returns the row referenced by rowIndex
+    */
+    virtual Vector<T> getRow(int rowIndex) const;
+    
+    
+    /*  Description: Getter for numRows
+        Preconditions: None
+        Postconditions: returns the number of rows in the matrix
+    */
+    virtual int getNumRows() const { return numRows; }
+    
+    
+    /*  Description: Getter for numCols
+        Preconditions: None
+        Postconditions: returns the number of columns in the matrix
+    */
+    virtual int getNumCols() const { return numRows; }
+    
+    
+    /*  Description: Getter for the half bandwidth
+        Preconditions: None
+        Postconditions: returns the largest |row-col| of a stored element,
+                        solvers can bound their inner loops by it
+    */
+    int bandwidth() const { return halfBandwidth; }
+    
+    
+    /*  Description: Determines if matrix is diagonally dominant
+        Preconditions: None
+        Postconditions: returns true if Aii > |Aij| for j!=i, else false
+    */
+    virtual bool isDiagonallyDominant() const;
+    
+    
+    /*  Description: Determines if matrix is symmetric
+        Preconditions: None
+        Postconditions: returns true, storage only holds the upper band
+    */
+    virtual bool symmetric() const { return true; }
+    
+    
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector, only visiting the band
+        Preconditions: None
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
+    /*  Description: Row Nonzeros, lists the nonzero elements of one row,
+                     only visiting the band
+        Preconditions: 0 <= rowIndex < numRows
+        Postconditions: columns and values hold the nonzeros of row
+                        rowIndex in column order
+                        throws RangeError if rowIndex is out of range
+    */
+    virtual void getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const;
+    
+    
+    /*  Description: Swap, exchanges the elements of two matrices without
+                     copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of other and
+                        vice versa
+    */
+    void swap(BandedSymmetricMatrix<T>& other) noexcept;
+    
+    
+    /*  Description: Setter for size
+        Preconditions: n must be a positive non-zero integer
+                       0 <= bandwidth < n
+        Postconditions: numRows = numCols = n, value of all elements in
+                        the band is set by the default constructor for T
+                        throws SizeError if n < 0 or bandwidth is out of range
+    */
+    void setSize(int n, int bandwidth);
+  
+  
+  private:
+    int numRows;
+    int halfBandwidth;
+    // row i of the band starts at band[i*(halfBandwidth+1)]
+    Vector<T> band;
+    // referenced by const operator() for elements outside of the band
+    T zero;
+    
+    
+    /*  Description: Widen, grows the band keeping all stored elements
+        Preconditions: newBandwidth < numRows
+        Postconditions: bandwidth() >= newBandwidth, new elements are zero
+    */
+    void widen(int newBandwidth);
+    
+    
+    /*  Description: Bandwidth Of, finds the band that holds a matrix
+        Preconditions: None
+        Postconditions: returns the largest |row-col| of a nonzero of matrix
+    */
+    static int bandwidthOf(const MatrixBase<T>& matrix);
+    
+    
+    /*  Description: Combine, adds scale*rhs to the calling object
+        Preconditions: rhs is a symmetric matrix of the same size
+        Postconditions: band is widened to hold rhs and merged with it
+    */
+    void combine(const MatrixBase<T>& rhs, const T& scale);
+
+};
+
+
+/*  Description: Swap, exchanges the elements of two matrices without
+                 copying them
+    Preconditions: None
+    Postconditions: a holds the elements of b and vice versa
+*/
+template<class T>
+void swap(BandedSymmetricMatrix<T>& a, BandedSymmetricMatrix<T>& b) noexcept { a.swap(b); }
+
+#include "BandedSymmetricMatrix.hpp"
+#endif
\ No newline at end of file
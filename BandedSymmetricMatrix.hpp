@@ -0,0 +1,290 @@
+/*
+  Filename:   BandedSymmetricMatrix.hpp
+  Author:     Raymond Hummel
+  Date:       5/13/2014
+  Purpose:    Contains the implementation of the BandedSymmetricMatrix class
+*/
+
+
+template<class T>
+BandedSymmetricMatrix<T>::BandedSymmetricMatrix(int n, int bandwidth)
+  :numRows(0), halfBandwidth(0), zero(0)
+{
+  setSize(n, bandwidth);
+}
+
+
+template<class T>
+BandedSymmetricMatrix<T>::BandedSymmetricMatrix(const MatrixBase<T>& original)
+  :numRows(0), halfBandwidth(0), zero(0)
+{
+  if( !original.symmetric() ) throw "Matrix must be symmetric";
+  setSize(original.getNumRows(), bandwidthOf(original));
+  for(int i=0; i < numRows; i++)
+  {
+    for(int j=i; j < numRows && j <= i+halfBandwidth; j++)
+    {
+      operator()(i,j) = original(i,j);
+    }
+  }
+}
+
+
+template<class T>
+T& BandedSymmetricMatrix<T>::operator()(int row, int col)
+{
+  if(row < 0 || row >= numRows) throw RangeError(row, "operator() row");
+  if(col < 0 || col >= numRows) throw RangeError(col, "operator() col");
+  if(row > col) // swap row and col if on wrong side of matrix
+  {
+    int temp = row;
+    row = col;
+    col = temp;
+  }
+  if(col-row > halfBandwidth) widen(col-row);
+  return band[row*(halfBandwidth+1) + col-row];
+}
+
+
+template<class T>
+const T& BandedSymmetricMatrix<T>::operator()(int row, int col) const
+{
+  if(row < 0 || row >= numRows) throw RangeError(row, "const operator() row");
+  if(col < 0 || col >= numRows) throw RangeError(col, "const operator() col");
+  if(row > col) // swap row and col if on wrong side of matrix
+  {
+    int temp = row;
+    row = col;
+    col = temp;
+  }
+  if(col-row > halfBandwidth) return zero;
+  return band[row*(halfBandwidth+1) + col-row];
+}
+
+
+template<class T>
+MatrixBase<T>& BandedSymmetricMatrix<T>::operator+=(const MatrixBase<T>& rhs)
+{
+  if( numRows != rhs.getNumRows() ) throw SizeError(numRows, "operator += row");
+  if( numRows != rhs.getNumCols() ) throw SizeError(numRows, "operator += col");
+  combine(rhs, T(1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& BandedSymmetricMatrix<T>::operator-=(const MatrixBase<T>& rhs)
+{
+  if( numRows != rhs.getNumRows() ) throw SizeError(numRows, "operator -= row");
+  if( numRows != rhs.getNumCols() ) throw SizeError(numRows, "operator -= col");
+  combine(rhs, T(-1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& BandedSymmetricMatrix<T>::operator*=(const T& rhs)
+{
+  band *= rhs;
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& BandedSymmetricMatrix<T>::operator*=(const MatrixBase<T>& rhs)
+{
+  if( numRows != rhs.getNumRows() ) throw SizeError(numRows, "operator *= matrix");
+  if( !rhs.symmetric() ) throw "Matrix must be symmetric";
+  int newBandwidth = halfBandwidth + bandwidthOf(rhs);
+  if(newBandwidth > numRows-1) newBandwidth = numRows-1;
+  BandedSymmetricMatrix<T> temp(numRows, newBandwidth);
+  for(int j=0; j < numRows; j++)
+  {
+    Vector<T> column = rhs.getColumn(j);
+    int first = (j > newBandwidth) ? j - newBandwidth : 0;
+    for(int i=first; i <= j; i++)
+    {
+      temp(i,j) = rowProduct(i, column);
+    }
+  }
+  swap(temp);
+  return *this;
+}
+
+
+template<class T>
+Vector<T> BandedSymmetricMatrix<T>::operator*(const Vector<T>& rhs) const
+{
+  if( numRows != rhs.getSize() ) throw SizeError(numRows, "operator * vector");
+  Vector<T> retVal(numRows);
+  for(int i=0; i < numRows; i++)
+  {
+    retVal[i] = rowProduct(i, rhs);
+  }
+  return retVal;
+}
+
+
+template<class T>
+Vector<T> BandedSymmetricMatrix<T>::getColumn(int colIndex) const
+{
+  if(colIndex < 0 || colIndex >= numRows) throw RangeError(colIndex, "getColumn");
+  // the matrix is symmetric
+  return getRow(colIndex);
+}
+
+
+template<class T>
+Vector<T> BandedSymmetricMatrix<T>::getRow(int rowIndex) const
+{
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "getRow");
+  Vector<T> row(numRows);
+  row = 0;
+  int first = (rowIndex > halfBandwidth) ? rowIndex - halfBandwidth : 0;
+  int last = (rowIndex + halfBandwidth < numRows) ? rowIndex + halfBandwidth : numRows-1;
+  for(int j=first; j <= last; j++)
+  {
+    row[j] = operator()(rowIndex, j);
+  }
+  return row;
+}
+
+
+template<class T>
+bool BandedSymmetricMatrix<T>::isDiagonallyDominant() const
+{
+  for(int i=0; i < numRows; i++)
+  {
+    T sum = 0;
+    int first = (i > halfBandwidth) ? i - halfBandwidth : 0;
+    int last = (i + halfBandwidth < numRows) ? i + halfBandwidth : numRows-1;
+    for(int j=first; j <= last; j++)
+    {
+      if(j != i)
+      {
+        sum += abs( operator()(i,j) );
+      }
+    }
+    if( sum > abs( operator()(i,i) ) ) return false;
+  }
+  return true;
+}
+
+
+template<class T>
+T BandedSymmetricMatrix<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if( numRows != x.getSize() ) throw SizeError(x.getSize(), "rowProduct");
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "rowProduct");
+  const int width = halfBandwidth+1;
+  T retVal = 0;
+  // lower part of the row is stored down the column of the rows above
+  int first = (rowIndex > halfBandwidth) ? rowIndex - halfBandwidth : 0;
+  for(int j=first; j < rowIndex; j++)
+  {
+    retVal += band[j*width + rowIndex-j] * x[j];
+  }
+  int last = (rowIndex + halfBandwidth < numRows) ? rowIndex + halfBandwidth : numRows-1;
+  for(int j=rowIndex; j <= last; j++)
+  {
+    retVal += band[rowIndex*width + j-rowIndex] * x[j];
+  }
+  return retVal;
+}
+
+
+template<class T>
+void BandedSymmetricMatrix<T>::getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const
+{
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "getRowNonzeros");
+  columns.clear();
+  values.clear();
+  int first = (rowIndex > halfBandwidth) ? rowIndex - halfBandwidth : 0;
+  int last = (rowIndex + halfBandwidth < numRows) ? rowIndex + halfBandwidth : numRows-1;
+  for(int j=first; j <= last; j++)
+  {
+    const T& element = operator()(rowIndex, j);
+    if(element != T(0))
+    {
+      columns.push_back(j);
+      values.push_back(element);
+    }
+  }
+}
+
+
+template<class T>
+void BandedSymmetricMatrix<T>::setSize(int n, int bandwidth)
+{
+  if(n < 0) throw SizeError(n, "setSize");
+  if(bandwidth < 0 || (n > 0 && bandwidth >= n)) throw SizeError(bandwidth, "setSize bandwidth");
+  numRows = n;
+  halfBandwidth = bandwidth;
+  band.setSize(numRows*(halfBandwidth+1));
+}
+
+
+template<class T>
+void BandedSymmetricMatrix<T>::swap(BandedSymmetricMatrix<T>& other) noexcept
+{
+  int tempRows = numRows;
+  int tempBandwidth = halfBandwidth;
+  numRows = other.numRows;
+  halfBandwidth = other.halfBandwidth;
+  other.numRows = tempRows;
+  other.halfBandwidth = tempBandwidth;
+  band.swap(other.band);
+}
+
+
+template<class T>
+void BandedSymmetricMatrix<T>::widen(int newBandwidth)
+{
+  if(newBandwidth <= halfBandwidth) return;
+  BandedSymmetricMatrix<T> temp(numRows, newBandwidth);
+  temp.band = 0;
+  for(int i=0; i < numRows; i++)
+  {
+    for(int j=i; j < numRows && j <= i+halfBandwidth; j++)
+    {
+      temp(i,j) = operator()(i,j);
+    }
+  }
+  swap(temp);
+}
+
+
+template<class T>
+int BandedSymmetricMatrix<T>::bandwidthOf(const MatrixBase<T>& matrix)
+{
+  const BandedSymmetricMatrix<T>* banded = dynamic_cast<const BandedSymmetricMatrix<T>*>(&matrix);
+  if(banded) return banded->halfBandwidth;
+  int retVal = 0;
+  for(int i=0; i < matrix.getNumRows(); i++)
+  {
+    for(int j=matrix.getNumCols()-1; j > i+retVal; j--)
+    {
+      if(matrix(i,j) != T(0))
+      {
+        retVal = j-i;
+        break;
+      }
+    }
+  }
+  return retVal;
+}
+
+
+template<class T>
+void BandedSymmetricMatrix<T>::combine(const MatrixBase<T>& rhs, const T& scale)
+{
+  if( !rhs.symmetric() ) throw "Matrix must be symmetric";
+  widen( bandwidthOf(rhs) );
+  for(int i=0; i < numRows; i++)
+  {
+    for(int j=i; j < numRows && j <= i+halfBandwidth; j++)
+    {
+      operator()(i,j) += scale * rhs(i,j);
+    }
+  }
+}
\ No newline at end of file
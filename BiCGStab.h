@@ -0,0 +1,148 @@
+/*
+  Filename:   BiCGStab.h
+  Author:     Raymond Hummel
+  Date:       5/28/2014
+  Purpose:    Contains the declaration of the BiCGStab class
+*/
+
+#ifndef BICGSTAB_H
+#define BICGSTAB_H
+
+#include "MatrixBase.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+
+using namespace std;
+
+
+/*
+Biconjugate gradient stabilized method for any nonsingular A. The
+biconjugate gradient step keeps r orthogonal to the Krylov space of A^T
+grown from a fixed shadow residual, which needs no symmetry, and each
+step is followed by a one dimensional minimal residual step along As
+that smooths the erratic convergence of plain BiCG. Every iteration costs
+two products with A and no product with A^T, so the work is O(nnz) per
+iteration for a sparse A and O(n^2) for a dense one.
+*/
+template<class T>
+class BiCGStab
+{
+  public:
+    /*  Description: Constructor, initializes member variables
+        Preconditions: None
+        Postconditions: no solve has been run
+    */
+    BiCGStab():iterations(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is nonsingular
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is nonsingular
+        Postconditions: x holds the approximate solution of Ax=b
+                        throws if the method breaks down
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      Norm<T> norm;
+      int n = b.getSize();
+      Vector<T>& r = workspace(0, n);
+      Vector<T>& shadow = workspace(1, n);
+      Vector<T>& p = workspace(2, n);
+      Vector<T>& Ap = workspace(3, n);
+      Vector<T>& s = workspace(4, n);
+      Vector<T>& As = workspace(5, n);
+      double error = 0.0000001;
+      T rho = 1, nextRho, alpha = 1, omega = 1, beta, AsAs;
+      
+      x.setSize(n);
+      x = 0;
+      r = b;
+      shadow = r;
+      p = 0;
+      Ap = 0;
+      
+      iterations = 0;
+      
+      while(true)
+      {
+        if(norm(r) <= error)
+        {
+          // the updated r drifts away from b - Ax by rounding, so the
+          // method only stops once the true residual is small too, and
+          // otherwise restarts from it
+          A.multiply(x, As);
+          r = b - As;
+          if(norm(r) <= error) break;
+          shadow = r;
+          rho = alpha = omega = 1;
+          p = 0;
+          Ap = 0;
+        }
+        
+        //biconjugate gradient step
+        nextRho = shadow * r;
+        if(nextRho == T(0)) throw "BiCGStab broke down, the residual is orthogonal to the shadow residual";
+        beta = (nextRho / rho) * (alpha / omega);
+        p = r + (p - Ap * omega) * beta;
+        A.multiply(p, Ap);
+        alpha = nextRho / (shadow * Ap);
+        s = r - Ap * alpha;
+        
+        //minimal residual step along As
+        A.multiply(s, As);
+        AsAs = As * As;
+        if(AsAs == T(0))
+        {
+          // s is already zero, the BiCG step solved the system
+          x += p * alpha;
+          r = s;
+          iterations++;
+          continue;
+        }
+        omega = (As * s) / AsAs;
+        if(omega == T(0)) throw "BiCGStab broke down, the minimal residual step vanished";
+        x += p * alpha + s * omega;
+        r = s - As * omega;
+        rho = nextRho;
+        
+        iterations++;
+        if(iterations > 5000)
+        {
+          cout << "BiCGStab method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+  
+  
+  private:
+    int iterations;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,299 @@
+/*
+  Filename:   Chebyshev.h
+  Author:     Raymond Hummel
+  Date:       5/29/2014
+  Purpose:    Contains the declaration of the Chebyshev class
+*/
+
+#ifndef CHEBYSHEV_H
+#define CHEBYSHEV_H
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "MatrixBase.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+#include "LanczosBounds.h"
+
+using namespace std;
+
+
+/*
+Chebyshev semi-iteration on D^-1 A for a symmetric positive definite A
+with diagonal D. When every eigenvalue of D^-1 A lies in [smallest,
+largest], the error after k steps is the k-th Chebyshev polynomial scaled
+to that interval, which is the smallest possible over it, and its three
+term recurrence fixes every step length in advance. So unlike conjugate
+gradients no inner product is taken inside the loop, each iteration is a
+product with A and one pass over the vectors, and the residual is only
+measured every checkInterval iterations. The bounds come from the mesh
+for the stencil, |4o/d|cos(pi/N) either side of 1, or are estimated. A
+largest bound below the true one makes the iteration diverge, while a
+smallest bound above the true one only slows it, so the estimate takes
+the smallest from a few Lanczos steps, which approach it from above, and
+the largest from the Gershgorin circles, which can not miss it. With bounds
+over the upper part of the spectrum only, a few iterations make a smoother
+with no reductions at all.
+*/
+template<class T>
+class Chebyshev
+{
+  public:
+    /*  Description: Constructor, selects the bounds and how often the
+                     residual is measured
+        Preconditions: smallest == largest == 0 or 0 < smallest < largest,
+                       checkInterval > 0
+        Postconditions: zero bounds are estimated from A on each solve
+                        throws if the bounds or checkInterval are out of
+                        range
+    */
+    Chebyshev(const T& smallest = 0, const T& largest = 0, int checkInterval = 10)
+      :smallest(0), largest(0), automatic(true), checkInterval(checkInterval), iterations(0)
+    {
+      if(checkInterval < 1) throw RangeError(checkInterval, "Chebyshev checkInterval");
+      if(smallest != T(0) || largest != T(0)) setBounds(smallest, largest);
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is symmetric positive definite
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is symmetric positive definite
+        Postconditions: x holds the approximate solution of Ax=b
+                        throws if A and b do not match or Aii <= 0
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      Vector<T>& diagonal = prepare(A, b, workspace);
+      if(automatic)
+      {
+        LanczosBounds<T> bounds;
+        bounds(A, diagonal, workspace, 1);
+        smallest = bounds.getSmallest();
+        largest = gershgorinBound(A, diagonal);
+      }
+      x.setSize(b.getSize());
+      x = 0;
+      iterations = run(A, b, x, workspace, 5000, true);
+      if(iterations > 5000)
+      {
+        cout << "Chebyshev method did not converge after 5000 iterations" << endl;
+      }
+    }
+    
+    
+    /*  Description: Iterate, takes a fixed number of steps from x without
+                     measuring the residual, for use as a smoother
+        Preconditions: the bounds are set, A is symmetric positive
+                       definite, x has the size of b
+        Postconditions: x is improved by count Chebyshev steps
+                        throws if the bounds were never set
+    */
+    void iterate(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x, int count,
+                 SolverWorkspace<T>& workspace)
+    {
+      prepare(A, b, workspace);
+      if(!(smallest > T(0))) throw "Chebyshev iterate needs bounds";
+      if(x.getSize() != b.getSize()) throw SizeError(x.getSize(), "Chebyshev iterate");
+      iterations = run(A, b, x, workspace, count, false);
+    }
+    
+    
+    /*  Description: Setter for the bounds
+        Preconditions: 0 < newSmallest < newLargest
+        Postconditions: every eigenvalue of D^-1 A is taken to lie in
+                        [newSmallest, newLargest]
+                        throws if the bounds are out of range
+    */
+    void setBounds(const T& newSmallest, const T& newLargest)
+    {
+      if(!(newSmallest > T(0)) || !(newSmallest < newLargest)) throw "Chebyshev bounds must satisfy 0 < smallest < largest";
+      smallest = newSmallest;
+      largest = newLargest;
+      automatic = false;
+    }
+    
+    
+    /*  Description: Set Mesh Bounds, takes the exact bounds of the stencil
+        Preconditions: N > 1, diag != 0, the stencil is diagonally
+                       dominant
+        Postconditions: the bounds of the N division mesh stencil with
+                        diagonal diag and offDiagonal off are used
+    */
+    void setMeshBounds(int N, const T& diag = 4, const T& off = -1)
+    {
+      const T pi = acos(T(-1));
+      T spread = abs(4*off/diag) * cos(pi/N);
+      setBounds(1 - spread, 1 + spread);
+    }
+    
+    
+    /*  Description: Set Automatic Bounds, estimates the bounds from A
+        Preconditions: None
+        Postconditions: every solve estimates the bounds with Lanczos steps
+    */
+    void setAutomaticBounds() { automatic = true; }
+    
+    
+    /*  Description: Getter for smallest
+        Preconditions: None
+        Postconditions: returns the lower bound used by the last solve
+    */
+    T getSmallest() const { return smallest; }
+    
+    
+    /*  Description: Getter for largest
+        Preconditions: None
+        Postconditions: returns the upper bound used by the last solve
+    */
+    T getLargest() const { return largest; }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+  
+  
+  private:
+    T smallest;
+    T largest;
+    bool automatic;
+    int checkInterval;
+    int iterations;
+    // one row of A while the Gershgorin bound is found
+    vector<int> columns;
+    vector<T> values;
+    
+    
+    /*  Description: Gershgorin Bound, bounds the eigenvalues of D^-1 A
+        Preconditions: diagonal holds the positive diagonal of A
+        Postconditions: returns the largest sum of |Aij|/Aii over a row,
+                        which no eigenvalue of D^-1 A exceeds
+    */
+    T gershgorinBound(const MatrixBase<T>& A, const Vector<T>& diagonal)
+    {
+      T bound = 0;
+      for(int i=0; i < A.getNumRows(); i++)
+      {
+        A.getRowNonzeros(i, columns, values);
+        T sum = 0;
+        for(int k=0; k < int(values.size()); k++)
+        {
+          sum += abs(values[k]);
+        }
+        if(sum / diagonal[i] > bound) bound = sum / diagonal[i];
+      }
+      return bound;
+    }
+    
+    
+    /*  Description: Prepare, checks the system and stores the diagonal
+        Preconditions: None
+        Postconditions: returns workspace slot 0 holding the diagonal of A
+                        throws if A and b do not match or Aii <= 0
+    */
+    Vector<T>& prepare(const MatrixBase<T>& A, const Vector<T>& b, SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      int n = b.getSize();
+      Vector<T>& diagonal = workspace(0, n);
+      for(int i=0; i < n; i++)
+      {
+        diagonal[i] = A(i,i);
+        if(!(diagonal[i] > T(0))) throw "Chebyshev needs a positive diagonal";
+      }
+      return diagonal;
+    }
+    
+    
+    /*  Description: Run, takes Chebyshev steps from x
+        Preconditions: workspace slot 0 holds the diagonal of A
+        Postconditions: stops after count steps, or when check is true
+                        once the residual is below 0.0000001, returns the
+                        number of steps taken, count+1 when check is true
+                        and the residual is still too large
+    */
+    int run(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+            SolverWorkspace<T>& workspace, int count, bool check)
+    {
+      Norm<T> norm;
+      int n = b.getSize();
+      Vector<T>& diagonal = workspace(0, n);
+      Vector<T>& r = workspace(1, n);
+      Vector<T>& d = workspace(2, n);
+      Vector<T>& Ad = workspace(3, n);
+      double error = 0.0000001;
+      // the interval is centre +- halfWidth
+      T centre = (largest + smallest) / 2;
+      T halfWidth = (largest - smallest) / 2;
+      // when the bounds meet, as they do for a single unknown, a slightly
+      // wider interval keeps the recurrence finite
+      if(halfWidth < centre * T(0.000001)) halfWidth = centre * T(0.000001);
+      T sigma = centre / halfWidth;
+      T rho = 1 / sigma;
+      
+      A.multiply(x, r);
+      r = b - r;
+      for(int i=0; i < n; i++)
+      {
+        d[i] = r[i] / (diagonal[i] * centre);
+      }
+      
+      int k = 0;
+      while(true)
+      {
+        if(check && k % checkInterval == 0 && norm(r) <= error)
+        {
+          // the updated r drifts from b - Ax by rounding, only stop when
+          // the true residual is small too and carry on from it otherwise
+          A.multiply(x, r);
+          r = b - r;
+          if(norm(r) <= error) break;
+        }
+        if(k == count)
+        {
+          if(check) k++;
+          break;
+        }
+        
+        //fixed step, then the next direction from the recurrence
+        x += d;
+        A.multiply(d, Ad);
+        T nextRho = 1 / (2*sigma - rho);
+        T keep = nextRho * rho;
+        T step = 2 * nextRho / halfWidth;
+        for(int i=0; i < n; i++)
+        {
+          r[i] -= Ad[i];
+          d[i] = keep * d[i] + step * r[i] / diagonal[i];
+        }
+        rho = nextRho;
+        k++;
+      }
+      return k;
+    }
+
+};
+
+#endif
\ No newline at end of file
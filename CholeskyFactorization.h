@@ -0,0 +1,131 @@
+/*
+  Filename:   CholeskyFactorization.h
+  Author:     Raymond Hummel
+  Date:       5/23/2014
+  Purpose:    Contains the declaration of the CholeskyFactorization class
+*/
+
+#ifndef CHOLESKYFACTORIZATION_H
+#define CHOLESKYFACTORIZATION_H
+
+#include <cmath>
+#include <vector>
+
+#include "SymmetricMatrix.h"
+#include "Vector.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+Factors a symmetric positive definite A as U^T U, where U is upper
+triangular. The upper triangle of A is packed one row after the other,
+which is exactly the shape of U, so U overwrites A in the same storage.
+Factoring costs O(n^3) once, after which every solve is one forward and
+one backward substitution, O(n^2). U keeps the band of A, so the factor
+and the substitutions stop at the last nonzero of each row and a banded A
+only pays for its band.
+*/
+template<class T>
+class CholeskyFactorization
+{
+  public:
+    /*  Description: Default Constructor, holds no factor
+        Preconditions: None
+        Postconditions: getSize() == 0
+    */
+    CholeskyFactorization() {}
+    
+    
+    /*  Description: Constructor, factors a copy of A
+        Preconditions: A is positive definite
+        Postconditions: solve uses the factor of A
+                        throws if a pivot is not positive
+    */
+    explicit CholeskyFactorization(const SymmetricMatrix<T>& A) { factor(A); }
+    
+    
+    /*  Description: Move Constructor, factors A in its own storage
+        Preconditions: A is positive definite
+        Postconditions: solve uses the factor of A, A is left empty
+                        throws if a pivot is not positive
+    */
+    explicit CholeskyFactorization(SymmetricMatrix<T>&& A) { factor(move(A)); }
+    
+    
+    /*  Description: Factor, replaces the factor with that of a copy of A
+        Preconditions: A is positive definite
+        Postconditions: solve uses the factor of A
+                        throws if a pivot is not positive
+    */
+    void factor(const SymmetricMatrix<T>& A);
+    
+    
+    /*  Description: Factor, replaces the factor with that of A, computed
+                     in the packed storage of A without a copy
+        Preconditions: A is positive definite
+        Postconditions: solve uses the factor of A, A is left empty
+                        throws if a pivot is not positive
+    */
+    void factor(SymmetricMatrix<T>&& A);
+    
+    
+    /*  Description: Solve, returns the solution of Ax=b
+        Preconditions: a matrix has been factored
+        Postconditions: returns x with U^T U x = b
+                        throws SizeError if b does not match the factor
+    */
+    Vector<T> solve(const Vector<T>& b) const;
+    
+    
+    /*  Description: Solve, finds the solution of Ax=b without allocating
+                     when x already has the size of b
+        Preconditions: a matrix has been factored, x is not b
+        Postconditions: x holds the solution of U^T U x = b
+                        throws SizeError if b does not match the factor
+    */
+    void solve(const Vector<T>& b, Vector<T>& x) const;
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the factored matrix
+    */
+    int getSize() const { return U.getNumRows(); }
+    
+    
+    /*  Description: Getter for the factor
+        Preconditions: None
+        Postconditions: returns the upper triangle U, read it only on or
+                        above the diagonal, the symmetric accessors mirror
+                        U into the lower triangle
+    */
+    const SymmetricMatrix<T>& getFactor() const { return U; }
+  
+  
+  private:
+    SymmetricMatrix<T> U;
+    // one past the last nonzero column of each row of U
+    vector<int> rowEnd;
+    
+    
+    /*  Description: Decompose, overwrites U with its Cholesky factor
+        Preconditions: U holds a symmetric matrix
+        Postconditions: U holds the upper factor
+                        throws if a pivot is not positive
+    */
+    void decompose();
+    
+    
+    /*  Description: Row Offset, locates row k of the packed factor
+        Preconditions: 0 <= k < n
+        Postconditions: returns the position of (k,k) in U, computed in
+                        size_t so large n does not overflow
+    */
+    static size_t rowOffset(int k, int n) { return size_t(k)*(2*size_t(n) - k + 1)/2; }
+
+};
+
+#include "CholeskyFactorization.hpp"
+#endif
\ No newline at end of file
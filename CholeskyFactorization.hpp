@@ -0,0 +1,103 @@
+/*
+  Filename:   CholeskyFactorization.hpp
+  Author:     Raymond Hummel
+  Date:       5/23/2014
+  Purpose:    Contains the implementation of the CholeskyFactorization class
+*/
+
+
+template<class T>
+void CholeskyFactorization<T>::factor(const SymmetricMatrix<T>& A)
+{
+  U = A;
+  decompose();
+}
+
+
+template<class T>
+void CholeskyFactorization<T>::factor(SymmetricMatrix<T>&& A)
+{
+  U = move(A);
+  decompose();
+}
+
+
+template<class T>
+Vector<T> CholeskyFactorization<T>::solve(const Vector<T>& b) const
+{
+  Vector<T> x;
+  solve(b, x);
+  return x;
+}
+
+
+template<class T>
+void CholeskyFactorization<T>::solve(const Vector<T>& b, Vector<T>& x) const
+{
+  int n = getSize();
+  if(b.getSize() != n) throw SizeError(b.getSize(), "CholeskyFactorization solve");
+  x.setSize(n);
+  x = b;
+  T* y = x.data();
+  const T* u = U.data();
+  // forward substitution with U^T, row k of U is column k of U^T, so once
+  // y[k] is known it is removed from every later equation
+  for(int k=0; k < n; k++)
+  {
+    const T* row = u + rowOffset(k, n);
+    y[k] = y[k] / row[0];
+    T value = y[k];
+    for(int j=k+1; j < rowEnd[k]; j++)
+    {
+      y[j] -= row[j-k] * value;
+    }
+  }
+  // backward substitution with U, one contiguous row at a time
+  for(int k=n-1; k >= 0; k--)
+  {
+    const T* row = u + rowOffset(k, n);
+    T sum = y[k];
+    for(int j=k+1; j < rowEnd[k]; j++)
+    {
+      sum -= row[j-k] * y[j];
+    }
+    y[k] = sum / row[0];
+  }
+}
+
+
+template<class T>
+void CholeskyFactorization<T>::decompose()
+{
+  int n = getSize();
+  T* u = U.data();
+  rowEnd.assign(n, 0);
+  for(int k=0; k < n; k++)
+  {
+    // row k of the packed triangle is (k,k) through (k,n-1)
+    T* rowK = u + rowOffset(k, n);
+    if( !(rowK[0] > 0) ) throw "CholeskyFactorization pivot is not positive";
+    T diagonal = sqrt(rowK[0]);
+    rowK[0] = diagonal;
+    int end = k+1;
+    for(int j=k+1; j < n; j++)
+    {
+      rowK[j-k] = rowK[j-k] / diagonal;
+      if(rowK[j-k] != T(0)) end = j+1;
+    }
+    rowEnd[k] = end;
+    // subtract the outer product of row k from the rows below, nothing
+    // past the last nonzero of row k changes, which on a banded matrix
+    // keeps the work inside the band
+    for(int i=k+1; i < end; i++)
+    {
+      T factor = rowK[i-k];
+      if(factor == T(0)) continue;
+      T* rowI = u + rowOffset(i, n);
+      for(int j=i; j < end; j++)
+      {
+        rowI[j-i] -= factor * rowK[j-k];
+      }
+    }
+  }
+}
\ No newline at end of file
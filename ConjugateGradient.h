@@ -0,0 +1,104 @@
+/*
+  Filename:   ConjugateGradient.h
+  Author:     Raymond Hummel
+  Date:       5/18/2014
+  Purpose:    Contains the declaration of the ConjugateGradient class
+*/
+
+#ifndef CONJUGATEGRADIENT_H
+#define CONJUGATEGRADIENT_H
+
+#include "MatrixBase.h"
+#include "SymmetricMatrix.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+
+template<class T>
+class ConjugateGradient
+{
+  public:
+    /*  Description: Constructor, initializes member variables
+        Preconditions: None
+        Postconditions: no solve has been run
+    */
+    ConjugateGradient():iterations(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is symmetric positive definite
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is symmetric positive definite
+        Postconditions: x holds the approximate solution of Ax=b
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      if(!isSymmetric(A)) throw "Matrix A must be symmetric";
+      Norm<T> norm;
+      int n = b.getSize();
+      Vector<T>& r = workspace(0, n);
+      Vector<T>& p = workspace(1, n);
+      Vector<T>& Ap = workspace(2, n);
+      double error = 0.0000001;
+      T alpha, rr, nextRR;
+      
+      x.setSize(n);
+      x = 0;
+      r = b;
+      p = r;
+      rr = r * r;
+      
+      iterations = 0;
+      
+      while( norm(r) > error )
+      {
+        //step along p
+        A.multiply(p, Ap);
+        alpha = rr / (p * Ap);
+        x += p * alpha;
+        r -= Ap * alpha;
+        
+        //next direction, A-conjugate to every previous one
+        nextRR = r * r;
+        p = r + p * (nextRR / rr);
+        rr = nextRR;
+        
+        iterations++;
+        if(iterations > 5000)
+        {
+          cout << "ConjugateGradient method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+  
+  
+  private:
+    int iterations;
+
+};
+
+#endif
\ No newline at end of file
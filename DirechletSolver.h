@@ -8,13 +8,36 @@
 #ifndef DIRECHLETSOLVER_H
 #define DIRECHLETSOLVER_H
 
+#include <vector>
+#include <memory>
+
 #include "SymmetricMatrix.h"
+#include "SparseMatrix.h"
+#include "BandedSymmetricMatrix.h"
+#include "StencilOperator.h"
 #include "SteepestDescent.h"
 #include "GaussianElimination.h"
+#include "CholeskyFactorization.h"
 #include "GaussSeidel.h"
+#include "RedBlackGaussSeidel.h"
+#include "LineGaussSeidel.h"
+#include "Jacobi.h"
+#include "SOR.h"
+#include "Chebyshev.h"
+#include "ConjugateGradient.h"
+#include "PipelinedConjugateGradient.h"
+#include "BiCGStab.h"
+#include "GMRES.h"
+#include "PreconditionedConjugateGradient.h"
+#include "IncompleteCholesky.h"
+#include "MultigridSolver.h"
+#include "FastPoissonSolver.h"
+#include "SolverWorkspace.h"
 #include "MatrixGenerator.h"
 #include "BoundaryFunction.h"
+#include "OperatorCache.h"
 #include "Vector.h"
+#include "Matrix.h"
 
 template<class T>
 class DirechletSolver
@@ -22,27 +45,60 @@ class DirechletSolver
   public:
     typedef T(*T_func)(T,T);
     
+    // storage used for the system matrix A, STENCIL never assembles A
+    enum Storage { SYMMETRIC, SPARSE, BANDED, STENCIL };
+    
+    // iterative method used to solve Ax=b, PRECONDITIONED_CG uses IC(0),
+    // MULTIGRID works on the mesh so it is fastest when N is a power of 2,
+    // FULL_MULTIGRID solves on the grids N/2, N/4, ... first and starts
+    // each finer grid from the interpolated coarse solution,
+    // RED_BLACK_GAUSS_SEIDEL sweeps each colour of the mesh on every core,
+    // SUCCESSIVE_OVER_RELAXATION and SYMMETRIC_SOR take omega from the mesh,
+    // CHOLESKY factors A once per mesh so a new U only costs two
+    // triangular solves, FAST_POISSON solves directly with sine transforms,
+    // JACOBI splits every sweep across all cores, LINE_GAUSS_SEIDEL solves
+    // whole mesh lines at once in zebra order, BICGSTAB and
+    // GMRES_RESTARTED do not rely on the symmetry of A, CHEBYSHEV takes its
+    // steps from the mesh bounds without inner products, PIPELINED_CG
+    // waits for the other threads once per iteration
+    enum Method { GAUSS_SEIDEL, STEEPEST_DESCENT, CONJUGATE_GRADIENT, PRECONDITIONED_CG,
+                  MULTIGRID, FULL_MULTIGRID, RED_BLACK_GAUSS_SEIDEL,
+                  SUCCESSIVE_OVER_RELAXATION, SYMMETRIC_SOR, CHOLESKY, FAST_POISSON,
+                  JACOBI, LINE_GAUSS_SEIDEL, BICGSTAB, GMRES_RESTARTED, CHEBYSHEV,
+                  PIPELINED_CG };
+    
     /*  Description: Constructor, initializes member variables
         Preconditions: numDivisions must be a positive, non-zero integer
                        T must have a defined default constructor
         Postconditions: A contains the proper matrix for a Direchlet problem 
                         with numDivisions sized mesh, U = function, 
-                        x and b are size numDivisions-1
+                        x and b are size numDivisions-1,
+                        the system is solved with method
     */
-    DirechletSolver(int numDivisions, T_func function):U(function){ setN(numDivisions); }
+    DirechletSolver(int numDivisions, T_func function, Storage type = SYMMETRIC,
+                    Method method = GAUSS_SEIDEL)
+      :U(function), storage(type), method(method) { setN(numDivisions); }
     
     
     /*  Description: Boundary function setter
         Preconditions: newU is a function pointer describing the boundary of the Direchlet problem
-        Postconditions: U = newU
+        Postconditions: U = newU, b is rebuilt for newU and A is kept
+    */
+    void setU(T_func newU){ U.setFunction(newU); buildVector(); }
+    
+    
+    /*  Description: Method setter
+        Preconditions: None
+        Postconditions: later solutions are found with newMethod
     */
-    void setU(T_func newU){ U.setFunction(newU); }
+    void setMethod(Method newMethod){ method = newMethod; }
     
     
     /*  Description: Setter for size of mesh to use in the solution
         Preconditions: newN must be a positive, non-zero integer
         Postconditions: A contains the proper matrix for a Direchlet problem 
-                        with N sized mesh, x and b are size (N-1)^2, N = newN
+                        with N sized mesh in the selected storage,
+                        x and b are size (N-1)^2, N = newN
     */
     void setN(int newN);
     
@@ -56,12 +112,47 @@ class DirechletSolver
     Vector<double> operator()();
     
     
+    /*  Description: Batched Function Evaluation Operator, solves the
+                     problem for many boundary functions on the same mesh
+        Preconditions: None
+        Postconditions: column c of the returned (N-1)^2 x functions.size()
+                        Matrix is the solution for boundary functions[c],
+                        GAUSS_SEIDEL sweeps every column together and the
+                        other methods solve the columns one after another,
+                        U is left as the last function
+    */
+    Matrix<double> operator()(const vector<T_func>& functions);
+  
+  
   private:
     BoundaryFunction<T,T_func> U;
-    SymmetricMatrix<double> A;
+    // shared with every solver of the same mesh and storage
+    shared_ptr<const MatrixBase<double> > A;
+    Storage storage;
+    Method method;
     Vector<double> x, b;
+    // scratch vectors kept between solves
+    SolverWorkspace<double> workspace;
+    // keeps its grid hierarchy between solves
+    MultigridSolver<double> multigrid;
+    // factor of A, looked up the first time CHOLESKY needs it
+    shared_ptr<const CholeskyFactorization<double> > cholesky;
+    // IC(0) of A, looked up the first time PRECONDITIONED_CG needs it
+    shared_ptr<const IncompleteCholesky<double> > incompleteCholesky;
+    // keeps its transform between solves
+    FastPoissonSolver<double> fastPoisson;
+    // keep their thread pools between solves
+    RedBlackGaussSeidel<double> redBlack;
+    Jacobi<double> jacobi;
+    LineGaussSeidel<double> lineGaussSeidel;
+    PipelinedConjugateGradient<double> pipelinedCG;
     int N;
     
+    // the solvers kept between solves are not shared, so copying is not
+    // allowed
+    DirechletSolver(const DirechletSolver<T>&);
+    DirechletSolver<T>& operator=(const DirechletSolver<T>&);
+    
     /*  Description: helper function to build the b vector
         Preconditions: None
         Postconditions: initializes b vector with the appropriate values for
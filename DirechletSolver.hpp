@@ -11,8 +11,20 @@ void DirechletSolver<T>::setN(int newN)
 {
   N = newN;
   int numMeshPoints = (N-1)*(N-1);
-  MatrixGenerator gen(N);
-  A = gen.getMatrix();
+  // the operator only depends on N and the storage, so it is assembled
+  // once for all solvers
+  Storage type = storage;
+  A = OperatorCache::shared().getOperator(N, storage, [newN, type]() -> MatrixBase<double>*
+  {
+    if(type == STENCIL) return new StencilOperator<double>(newN);
+    MatrixGenerator gen(newN);
+    if(type == SPARSE) return new SparseMatrix<double>(gen.getSparseMatrix());
+    if(type == BANDED) return new BandedSymmetricMatrix<double>(gen.getBandedMatrix());
+    return new SymmetricMatrix<double>(gen.getMatrix());
+  });
+  // the factors belong to the previous mesh
+  cholesky.reset();
+  incompleteCholesky.reset();
   x.setSize(numMeshPoints);
   b.setSize(numMeshPoints);
   buildVector();
@@ -22,18 +34,154 @@ void DirechletSolver<T>::setN(int newN)
 template<class T>
 Vector<double> DirechletSolver<T>::operator()()
 {
-  //SteepestDescent<double> solver1;
   //GaussianElimination<double> solver2;
-  GaussSeidel<double> solver3;
   
-  //cout << "steepest descent: " << endl << solver1(A,b) << endl;
-  //cout << "gauss-seidel: " << endl << solver3(A,b) << endl;
-  x = solver3(A,b);
+  if(method == FULL_MULTIGRID)
+  {
+    const StencilOperator<double>* stencil = dynamic_cast<const StencilOperator<double>*>(A.get());
+    if(stencil) multigrid.fullMultigrid(*stencil,b,x);
+    else multigrid.fullMultigrid(StencilOperator<double>(N),b,x);
+  }
+  else if(method == FAST_POISSON)
+  {
+    const StencilOperator<double>* stencil = dynamic_cast<const StencilOperator<double>*>(A.get());
+    if(stencil) fastPoisson(*stencil,b,x);
+    else fastPoisson(StencilOperator<double>(N),b,x);
+  }
+  else if(method == MULTIGRID)
+  {
+    // every storage holds the same stencil, so the mesh is all it needs
+    const StencilOperator<double>* stencil = dynamic_cast<const StencilOperator<double>*>(A.get());
+    if(stencil) multigrid(*stencil,b,x);
+    else multigrid(StencilOperator<double>(N),b,x);
+  }
+  else if(method == RED_BLACK_GAUSS_SEIDEL)
+  {
+    const StencilOperator<double>* stencil = dynamic_cast<const StencilOperator<double>*>(A.get());
+    if(stencil) redBlack(*stencil,b,x);
+    else redBlack(StencilOperator<double>(N),b,x);
+  }
+  else if(method == CHOLESKY)
+  {
+    if(!cholesky)
+    {
+      const SymmetricMatrix<double>* packed = dynamic_cast<const SymmetricMatrix<double>*>(A.get());
+      int meshN = N;
+      cholesky = OperatorCache::shared().getCholesky(N, [packed, meshN]()
+      {
+        CholeskyFactorization<double>* factor = new CholeskyFactorization<double>();
+        if(packed) factor->factor(*packed);
+        else factor->factor(MatrixGenerator(meshN).getMatrix());
+        return factor;
+      });
+    }
+    cholesky->solve(b,x);
+  }
+  else if(method == PIPELINED_CG)
+  {
+    pipelinedCG(*A,b,x,workspace);
+  }
+  else if(method == CHEBYSHEV)
+  {
+    Chebyshev<double> solver12;
+    // the Direchlet stencil has diagonal 1 and offDiagonal -1/N
+    solver12.setMeshBounds(N, 1, -1.0/N);
+    solver12(*A,b,x,workspace);
+  }
+  else if(method == BICGSTAB)
+  {
+    BiCGStab<double> solver10;
+    solver10(*A,b,x,workspace);
+  }
+  else if(method == GMRES_RESTARTED)
+  {
+    GMRES<double> solver11;
+    solver11(*A,b,x,workspace);
+  }
+  else if(method == LINE_GAUSS_SEIDEL)
+  {
+    const StencilOperator<double>* stencil = dynamic_cast<const StencilOperator<double>*>(A.get());
+    if(stencil) lineGaussSeidel(*stencil,b,x);
+    else lineGaussSeidel(StencilOperator<double>(N),b,x);
+  }
+  else if(method == JACOBI)
+  {
+    jacobi(*A,b,x,workspace);
+  }
+  else if(method == SUCCESSIVE_OVER_RELAXATION || method == SYMMETRIC_SOR)
+  {
+    SOR<double> solver7(method == SYMMETRIC_SOR ? SOR<double>::SYMMETRIC : SOR<double>::FORWARD);
+    // every storage holds the Direchlet stencil, diagonal 1 and offDiagonal -1/N
+    solver7.setMeshOmega(N, 1, -1.0/N);
+    solver7(*A,b,x,workspace);
+  }
+  else if(method == PRECONDITIONED_CG)
+  {
+    if(!incompleteCholesky)
+    {
+      const MatrixBase<double>& matrix = *A;
+      incompleteCholesky = OperatorCache::shared().getIncompleteCholesky(N, storage, [&matrix]()
+      {
+        return new IncompleteCholesky<double>(matrix);
+      });
+    }
+    PreconditionedConjugateGradient<double> solver5(*incompleteCholesky);
+    solver5(*A,b,x,workspace);
+  }
+  else if(method == CONJUGATE_GRADIENT)
+  {
+    ConjugateGradient<double> solver4;
+    solver4(*A,b,x,workspace);
+  }
+  else if(method == STEEPEST_DESCENT)
+  {
+    SteepestDescent<double> solver1;
+    solver1(*A,b,x,workspace);
+  }
+  else
+  {
+    GaussSeidel<double> solver3;
+    solver3(*A,b,x,workspace);
+  }
   
   return x/* * (1.0/N)*/;
 }
 
 
+template<class T>
+Matrix<double> DirechletSolver<T>::operator()(const vector<T_func>& functions)
+{
+  int n = b.getSize();
+  int k = functions.size();
+  Matrix<double> X(n, k);
+  if(method == GAUSS_SEIDEL)
+  {
+    // one right-hand side per column, so every row of A is read once
+    // per sweep for all of them
+    Matrix<double> B(n, k);
+    for(int c=0; c < k; c++)
+    {
+      U.setFunction(functions[c]);
+      buildVector();
+      for(int i=0; i < n; i++) B(i,c) = b[i];
+    }
+    GaussSeidel<double> solver3;
+    solver3(*A,B,X);
+    return X;
+  }
+  
+  // the other methods keep what they can between columns, the factor,
+  // the transform or the grid hierarchy
+  for(int c=0; c < k; c++)
+  {
+    setU(functions[c]);
+    operator()();
+    for(int i=0; i < n; i++) X(i,c) = x[i];
+  }
+  return X;
+}
+
+
 template<class T>
 void DirechletSolver<T>::buildVector()
 {
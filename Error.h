@@ -13,6 +13,22 @@
 
 #include <string>
 
+using namespace std;
+
+
+/*
+Element accessors check their subscripts and throw RangeError while
+BOUNDS_CHECK is nonzero. Like assert, the checks are compiled out when
+NDEBUG is defined, compile with -DBOUNDS_CHECK=1 to keep them anyway.
+*/
+#ifndef BOUNDS_CHECK
+#ifdef NDEBUG
+#define BOUNDS_CHECK 0
+#else
+#define BOUNDS_CHECK 1
+#endif
+#endif
+
 
 class RangeError
 {
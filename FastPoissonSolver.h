@@ -0,0 +1,194 @@
+/*
+  Filename:   FastPoissonSolver.h
+  Author:     Raymond Hummel
+  Date:       5/25/2014
+  Purpose:    Contains the declaration of the FastPoissonSolver class
+*/
+
+#ifndef FASTPOISSONSOLVER_H
+#define FASTPOISSONSOLVER_H
+
+#include <vector>
+#include <complex>
+#include <cmath>
+
+#include "StencilOperator.h"
+#include "FourierTransform.h"
+#include "Vector.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+Direct solver for the 5-point stencil on the unit square. With m = N-1
+points per line, the sine vectors s_p(i) = sin(pi*i*p/N) are eigenvectors
+of the one dimensional second difference, so the stencil is diagonalized
+by the sine transform S along both directions:
+A = (2/N)^2 S L S with L(p,q) = diagonal + 2 offDiagonal (cos(pi p/N) +
+cos(pi q/N)). The solution is x = (2/N)^2 S (S b S / L) S, four sine
+transforms of every line and no iteration.
+
+Each sine transform of a line is taken from a Fourier transform of length
+2N of the line's odd extension. Two lines go through each Fourier
+transform, one as the real part and one as the imaginary part, since the
+transform of an odd real sequence is purely imaginary. Lines across the
+mesh are transformed after transposing it, so every line is contiguous.
+The whole solve is O(N^2 log N).
+*/
+template<class T>
+class FastPoissonSolver
+{
+  public:
+    /*  Description: Constructor, initializes member variables
+        Preconditions: None
+        Postconditions: no transform has been prepared
+    */
+    FastPoissonSolver():N(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: no eigenvalue of A is zero
+        Postconditions: returns Vector representing the solution of Ax=b
+    */
+    Vector<T> operator()(const StencilOperator<T>& A, const Vector<T>& b)
+    {
+      Vector<T> x;
+      operator()(A, b, x);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b reusing the
+                     transform of the previous solve when the mesh is the
+                     same
+        Preconditions: no eigenvalue of A is zero, x is not b
+        Postconditions: x holds the solution of Ax=b
+                        throws SizeError if b does not match A, throws if
+                        A is singular
+    */
+    void operator()(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x)
+    {
+      if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "FastPoissonSolver");
+      setN(A.getN());
+      const int m = N-1;
+      x.setSize(b.getSize());
+      x = b;
+      T* u = x.data();
+      
+      // S b S, transposed
+      transformLines(u);
+      transpose(u);
+      transformLines(u);
+      // L is symmetric in p and q, so the transposed coefficients divide
+      // just the same
+      for(int q=0; q < m; q++)
+      {
+        for(int p=0; p < m; p++)
+        {
+          T eigenvalue = A.getDiagonal() + 2*A.getOffDiagonal()*(cosines[p] + cosines[q]);
+          if(eigenvalue == T(0)) throw "FastPoissonSolver operator is singular";
+          u[q*m + p] = u[q*m + p] / eigenvalue;
+        }
+      }
+      transformLines(u);
+      transpose(u);
+      transformLines(u);
+      // S S = (N/2) I, four transforms leave (N/2)^2 to remove
+      T scale = T(4) / (T(N)*N);
+      for(int i=0; i < m*m; i++)
+      {
+        u[i] = u[i] * scale;
+      }
+    }
+  
+  
+  private:
+    int N;
+    FourierTransform<T> fourier;
+    // cos(pi p/N) for the modes p = 1 to N-1
+    vector<T> cosines;
+    vector<complex<T> > line;
+    
+    
+    /*  Description: Set N, prepares the transforms for an N division mesh
+        Preconditions: N > 1
+        Postconditions: nothing is recomputed when newN is the current N
+    */
+    void setN(int newN)
+    {
+      if(newN == N) return;
+      N = newN;
+      fourier.setSize(2*N);
+      line.resize(2*N);
+      const T pi = acos(T(-1));
+      cosines.resize(N-1);
+      for(int p=1; p < N; p++)
+      {
+        cosines[p-1] = cos(pi*p/N);
+      }
+    }
+    
+    
+    /*  Description: Transform Lines, sine transforms every mesh line
+        Preconditions: u holds (N-1)^2 values, line after line
+        Postconditions: line i of u holds sum_j u(i,j) sin(pi jp/N) for
+                        p = 1 to N-1
+    */
+    void transformLines(T* u)
+    {
+      const int m = N-1;
+      for(int first=0; first < m; first += 2)
+      {
+        T* real = u + first*m;
+        T* imaginary = first+1 < m ? real + m : NULL;
+        // odd extension, 0 x1 .. xm 0 -xm .. -x1
+        line[0] = 0;
+        line[N] = 0;
+        for(int j=0; j < m; j++)
+        {
+          complex<T> value(real[j], imaginary ? imaginary[j] : T(0));
+          line[j+1] = value;
+          line[2*N-1-j] = -value;
+        }
+        fourier.forward(line);
+        // the transform of each odd line is -2i times its sine transform
+        for(int p=0; p < m; p++)
+        {
+          real[p] = -line[p+1].imag() / 2;
+          if(imaginary) imaginary[p] = line[p+1].real() / 2;
+        }
+      }
+    }
+    
+    
+    /*  Description: Transpose, swaps the mesh directions in place
+        Preconditions: u holds (N-1)^2 values
+        Postconditions: u(i,j) and u(j,i) are exchanged
+    */
+    void transpose(T* u)
+    {
+      const int m = N-1;
+      // tiles of TILE x TILE, so the lines read across the mesh are still
+      // in cache when the next element of each is needed
+      const int TILE = 32;
+      for(int top=0; top < m; top += TILE)
+      {
+        for(int left=top; left < m; left += TILE)
+        {
+          for(int i=top; i < m && i < top+TILE; i++)
+          {
+            for(int j=(left == top ? i+1 : left); j < m && j < left+TILE; j++)
+            {
+              T temp = u[i*m + j];
+              u[i*m + j] = u[j*m + i];
+              u[j*m + i] = temp;
+            }
+          }
+        }
+      }
+    }
+
+};
+
+#endif
\ No newline at end of file
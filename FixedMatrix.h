@@ -0,0 +1,164 @@
+/*
+  Filename:   FixedMatrix.h
+  Author:     Raymond Hummel
+  Date:       5/17/2014
+  Purpose:    Contains the declaration of a matrix class whose size is
+              fixed at compile time
+*/
+
+
+#ifndef FIXEDMATRIX_H
+#define FIXEDMATRIX_H
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+
+#include "FixedVector.h"
+#include "MatrixBase.h"
+#include "Error.h"
+
+using namespace std;
+
+// put before a loop of a fixed-size kernel to have it unrolled completely,
+// at -O2 the compiler only unrolls the innermost loops on its own, and the
+// loops of an elimination have bounds that depend on the outer ones
+#if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 8)
+#define FIXED_UNROLL _Pragma("GCC unroll 16")
+#else
+#define FIXED_UNROLL
+#endif
+
+
+/*
+A FixedMatrix keeps its R*C elements inside the object, stored by row.
+It is not derived from MatrixBase, so none of its calls go through a
+virtual function and the compiler sees every loop bound. It is meant for
+batches of small systems, larger ones should use Matrix.
+*/
+template<class T, int R, int C>
+class FixedMatrix
+{
+  public:
+    /*  Description: Default Constructor, creates FixedMatrix of size R by C
+        Preconditions: R, C must be positive, non-zero integers
+                       T must have a defined default constructor
+        Postconditions: every element is set by the default constructor
+                        for T
+    */
+    FixedMatrix() {}
+    
+    
+    /*  Description: Base Constructor, copies a runtime sized matrix
+        Preconditions: original must be R by C
+        Postconditions: calling object holds every element of original
+                        throws SizeError if original is not R by C
+    */
+    explicit FixedMatrix(const MatrixBase<T>& original);
+    
+    
+    /*  Description: Matrix Subscripting Operator, provides access to
+                     elements of the matrix
+        Preconditions: 0 <= row < R, 0 <= col < C
+        Postconditions: returns a reference to the element at row, col
+                        throws a RangeError if row or col is out of range
+                        and BOUNDS_CHECK is on
+    */
+    T& operator()(int row, int col);
+    
+    
+    /*  Description: const Matrix Subscripting Operator, provides read-only
+                     access to elements of the matrix
+        Preconditions: 0 <= row < R, 0 <= col < C
+        Postconditions: returns a const reference to the element at row, col
+                        throws a RangeError if row or col is out of range
+                        and BOUNDS_CHECK is on
+    */
+    const T& operator()(int row, int col) const;
+    
+    
+    /*  Description: Assignment Operator, sets all elements to rhs
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: all elements are equal to rhs
+    */
+    FixedMatrix<T,R,C>& operator=(const T& rhs);
+    
+    
+    /*  Description: Vector Multiplication, multiplies the matrix by a vector
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+        Postconditions: returns the product, a vector of size R
+    */
+    FixedVector<T,R> operator*(const FixedVector<T,C>& rhs) const;
+    
+    
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector
+        Preconditions: 0 <= rowIndex < R
+        Postconditions: returns the dot product of row rowIndex and x
+    */
+    T rowProduct(int rowIndex, const FixedVector<T,C>& x) const;
+    
+    
+    /*  Description: Swap Rows, exchanges two rows of the matrix
+        Preconditions: 0 <= row1, row2 < R
+        Postconditions: row1 holds the elements of row2 and vice versa
+    */
+    void swapRows(int row1, int row2);
+    
+    
+    /*  Description: Determines if matrix is diagonally dominant
+        Preconditions: None
+        Postconditions: returns true if Aii > |Aij| for j!=i, else false
+    */
+    bool isDiagonallyDominant() const;
+    
+    
+    /*  Description: Getter for numRows
+        Preconditions: None
+        Postconditions: returns R, usable in constant expressions
+    */
+    constexpr int getNumRows() const { return R; }
+    
+    
+    /*  Description: Getter for numCols
+        Preconditions: None
+        Postconditions: returns C, usable in constant expressions
+    */
+    constexpr int getNumCols() const { return C; }
+    
+    
+    /*  Description: Raw Access, provides the element array for kernels
+                     that loop over it directly
+        Preconditions: None
+        Postconditions: returns a pointer to the R*C elements stored by
+                        row, element (i,j) is at [i*C + j]
+    */
+    T* data() { return elements; }
+    
+    
+    /*  Description: const Raw Access, provides read-only access to the
+                     element array
+        Preconditions: None
+        Postconditions: returns a pointer to the elements stored by row
+    */
+    const T* data() const { return elements; }
+  
+  
+  private:
+    T elements[R*C];
+
+};
+
+
+/*  Description: Extraction operator
+    Preconditions: None
+    Postconditions: elements of matrix are streamed to output,
+                    rows separated by newlines
+*/
+template<class T, int R, int C>
+ostream& operator<<( ostream& output, const FixedMatrix<T,R,C>& matrix);
+
+
+#include "FixedMatrix.hpp"
+#endif
\ No newline at end of file
@@ -0,0 +1,132 @@
+/*
+  Filename:   FixedMatrix.hpp
+  Author:     Raymond Hummel
+  Date:       5/17/2014
+  Purpose:    Contains the implementation of the FixedMatrix class
+*/
+
+
+template<class T, int R, int C>
+FixedMatrix<T,R,C>::FixedMatrix(const MatrixBase<T>& original)
+{
+  if( original.getNumRows() != R ) throw SizeError(original.getNumRows(), "FixedMatrix rows");
+  if( original.getNumCols() != C ) throw SizeError(original.getNumCols(), "FixedMatrix cols");
+  for(int i=0; i < R; i++)
+  {
+    for(int j=0; j < C; j++)
+    {
+      elements[i*C + j] = original(i,j);
+    }
+  }
+}
+
+
+template<class T, int R, int C>
+T& FixedMatrix<T,R,C>::operator()(int row, int col)
+{
+#if BOUNDS_CHECK
+  if(row < 0 || row >= R) throw RangeError(row, "operator() row");
+  if(col < 0 || col >= C) throw RangeError(col, "operator() col");
+#endif
+  return elements[row*C + col];
+}
+
+
+template<class T, int R, int C>
+const T& FixedMatrix<T,R,C>::operator()(int row, int col) const
+{
+#if BOUNDS_CHECK
+  if(row < 0 || row >= R) throw RangeError(row, "const operator() row");
+  if(col < 0 || col >= C) throw RangeError(col, "const operator() col");
+#endif
+  return elements[row*C + col];
+}
+
+
+template<class T, int R, int C>
+FixedMatrix<T,R,C>& FixedMatrix<T,R,C>::operator=(const T& rhs)
+{
+  for(int i=0; i < R*C; i++)
+  {
+    elements[i] = rhs;
+  }
+  return *this;
+}
+
+
+template<class T, int R, int C>
+FixedVector<T,R> FixedMatrix<T,R,C>::operator*(const FixedVector<T,C>& rhs) const
+{
+  FixedVector<T,R> retVal;
+  for(int i=0; i < R; i++)
+  {
+    retVal[i] = rowProduct(i, rhs);
+  }
+  return retVal;
+}
+
+
+template<class T, int R, int C>
+T FixedMatrix<T,R,C>::rowProduct(int rowIndex, const FixedVector<T,C>& x) const
+{
+  const T* row = elements + rowIndex*C;
+  const T* values = x.data();
+  T retVal = 0;
+  for(int j=0; j < C; j++)
+  {
+    retVal += row[j] * values[j];
+  }
+  return retVal;
+}
+
+
+template<class T, int R, int C>
+void FixedMatrix<T,R,C>::swapRows(int row1, int row2)
+{
+  if(row1 == row2) return;
+  T* first = elements + row1*C;
+  T* second = elements + row2*C;
+  for(int j=0; j < C; j++)
+  {
+    T temp = first[j];
+    first[j] = second[j];
+    second[j] = temp;
+  }
+}
+
+
+template<class T, int R, int C>
+bool FixedMatrix<T,R,C>::isDiagonallyDominant() const
+{
+  for(int i=0; i < R && i < C; i++)
+  {
+    T sum = 0;
+    for(int j=0; j < C; j++)
+    {
+      if(j != i)
+      {
+        sum += abs( elements[i*C + j] );
+      }
+    }
+    if( sum > abs( elements[i*C + i] ) ) return false;
+  }
+  return true;
+}
+
+
+template<class T, int R, int C>
+ostream& operator<<( ostream& output, const FixedMatrix<T,R,C>& matrix)
+{
+  output.precision(3);
+  for(int i=0; i < R; i++)
+  {
+    for(int j=0; j < C; j++)
+    {
+      output.width(8);
+      output << matrix(i,j);
+    }
+    output << endl;
+  }
+  output.precision(6);
+  return output;
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+/*
+  Filename:   FixedVector.h
+  Author:     Raymond Hummel
+  Date:       5/17/2014
+  Purpose:    Contains the declaration of a vector class whose size is
+              fixed at compile time
+*/
+
+
+#ifndef FIXEDVECTOR_H
+#define FIXEDVECTOR_H
+
+#include <iostream>
+
+#include "VectorExpression.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+A FixedVector keeps its N elements inside the object, so it lives on the
+stack with no heap allocation and every loop over it has a constant trip
+count that the compiler can unroll. It is a VectorExpression, so +, -,
+scalar *, the dot product and Norm all work on it, and it can be assigned
+to or used to construct a Vector.
+*/
+template<class T, int N>
+class FixedVector: public VectorExpression<T, FixedVector<T,N> >
+{
+  public:
+    /*  Description: Default Constructor, creates FixedVector of size N
+        Preconditions: N must be a positive, non-zero integer
+                       T must have a defined default constructor
+        Postconditions: every element is set by the default constructor
+                        for T
+    */
+    FixedVector() {}
+    
+    
+    /*  Description: Fill Constructor, sets every element to value
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: every element equals value
+    */
+    explicit FixedVector(const T& value) { operator=(value); }
+    
+    
+    /*  Description: Expression Constructor, evaluates a vector expression
+                     in a single pass
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: calling object holds every element of expression
+                        throws SizeError if expression is not size N
+    */
+    template<class E>
+    FixedVector(const VectorExpression<T,E>& expression);
+    
+    
+    /*  Description: Vector Subscripting Operator, provides access to
+                     elements of the vector
+        Preconditions: i is a positive integer between 0 and N-1
+        Postconditions: returns a reference to the ith element
+                        throws a RangeError if i < 0 or i >= N and
+                        BOUNDS_CHECK is on
+    */
+    T& operator[](int i);
+    
+    
+    /*  Description: const Vector Subscripting Operator, provides read-only
+                     access to elements of the vector
+        Preconditions: i is a positive integer between 0 and N-1
+        Postconditions: returns a const reference to the ith element
+                        throws a RangeError if i < 0 or i >= N and
+                        BOUNDS_CHECK is on
+    */
+    const T& operator[](int i) const;
+    
+    
+    /*  Description: Expression Assignment Operator, evaluates a vector
+                     expression in a single pass
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: calling object holds every element of rhs
+                        throws SizeError if rhs is not size N
+    */
+    template<class E>
+    FixedVector<T,N>& operator=(const VectorExpression<T,E>& rhs);
+    
+    
+    /*  Description: Assignment Operator, sets all elements to rhs
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: all elements are equal to rhs
+    */
+    FixedVector<T,N>& operator=(const T& rhs);
+    
+    
+    /*  Description: Vector Addition Assignment, adds an expression
+                     element-wise
+        Preconditions: T must have a defined addition operator
+        Postconditions: calling object is the element-wise sum
+                        throws SizeError if rhs is not size N
+    */
+    template<class E>
+    FixedVector<T,N>& operator+=(const VectorExpression<T,E>& rhs);
+    
+    
+    /*  Description: Vector Subtraction Assignment, subtracts an expression
+                     element-wise
+        Preconditions: T must have a defined subtraction operator
+        Postconditions: calling object is the element-wise difference
+                        throws SizeError if rhs is not size N
+    */
+    template<class E>
+    FixedVector<T,N>& operator-=(const VectorExpression<T,E>& rhs);
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns N, usable in constant expressions
+    */
+    constexpr int getSize() const { return N; }
+    
+    
+    /*  Description: Raw Access, provides the element array for kernels
+                     that loop over it directly
+        Preconditions: None
+        Postconditions: returns a pointer to the N contiguous elements
+    */
+    T* data() { return elements; }
+    
+    
+    /*  Description: const Raw Access, provides read-only access to the
+                     element array
+        Preconditions: None
+        Postconditions: returns a pointer to the N contiguous elements
+    */
+    const T* data() const { return elements; }
+  
+  
+  private:
+    T elements[N];
+
+};
+
+
+/*  Description: Extraction operator
+    Preconditions: None
+    Postconditions: elements of vector are streamed to output on one
+                    line, each right aligned in a field 8 wide with 3
+                    significant digits and a newline after the last,
+                    magnitudes below 0.0000001 print as 0
+*/
+template<class T, int N>
+ostream& operator<<( ostream& output, const FixedVector<T,N>& vector);
+
+
+#include "FixedVector.hpp"
+#endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+/*
+  Filename:   FixedVector.hpp
+  Author:     Raymond Hummel
+  Date:       5/17/2014
+  Purpose:    Contains the implementation of the FixedVector class
+*/
+
+
+template<class T, int N>
+template<class E>
+FixedVector<T,N>::FixedVector(const VectorExpression<T,E>& expression)
+{
+  operator=(expression);
+}
+
+
+template<class T, int N>
+T& FixedVector<T,N>::operator[](int i)
+{
+#if BOUNDS_CHECK
+  if(i < 0 || i >= N) throw RangeError(i, "operator[]");
+#endif
+  return elements[i];
+}
+
+
+template<class T, int N>
+const T& FixedVector<T,N>::operator[](int i) const
+{
+#if BOUNDS_CHECK
+  if(i < 0 || i >= N) throw RangeError(i, "const operator[]");
+#endif
+  return elements[i];
+}
+
+
+template<class T, int N>
+template<class E>
+FixedVector<T,N>& FixedVector<T,N>::operator=(const VectorExpression<T,E>& rhs)
+{
+  const E& source = static_cast<const E&>(rhs);
+  if(source.getSize() != N) throw SizeError(source.getSize(), "operator=");
+  for(int i=0; i < N; i++)
+  {
+    elements[i] = source[i];
+  }
+  return *this;
+}
+
+
+template<class T, int N>
+FixedVector<T,N>& FixedVector<T,N>::operator=(const T& rhs)
+{
+  for(int i=0; i < N; i++)
+  {
+    elements[i] = rhs;
+  }
+  return *this;
+}
+
+
+template<class T, int N>
+template<class E>
+FixedVector<T,N>& FixedVector<T,N>::operator+=(const VectorExpression<T,E>& rhs)
+{
+  const E& expression = static_cast<const E&>(rhs);
+  if(expression.getSize() != N) throw SizeError(expression.getSize(), "operator+=");
+  for(int i=0; i < N; i++)
+  {
+    elements[i] = elements[i] + expression[i];
+  }
+  return *this;
+}
+
+
+template<class T, int N>
+template<class E>
+FixedVector<T,N>& FixedVector<T,N>::operator-=(const VectorExpression<T,E>& rhs)
+{
+  const E& expression = static_cast<const E&>(rhs);
+  if(expression.getSize() != N) throw SizeError(expression.getSize(), "operator-=");
+  for(int i=0; i < N; i++)
+  {
+    elements[i] = elements[i] - expression[i];
+  }
+  return *this;
+}
+
+
+template<class T, int N>
+ostream& operator<<( ostream& output, const FixedVector<T,N>& vector)
+{
+  output.precision(3);
+  for(int i=0; i < N; i++)
+  {
+    output.width(8);
+    if(abs(vector[i]) < 0.0000001)
+    {
+      output << 0 << "";
+    }
+    else
+    {
+      output << vector[i] << "";
+    }
+  }
+  output << endl;
+  output.precision(6);
+  return output;
+}
\ No newline at end of file
@@ -0,0 +1,112 @@
+/*
+  Filename:   FourierTransform.h
+  Author:     Raymond Hummel
+  Date:       5/25/2014
+  Purpose:    Contains the declaration of the FourierTransform class
+*/
+
+#ifndef FOURIERTRANSFORM_H
+#define FOURIERTRANSFORM_H
+
+#include <vector>
+#include <complex>
+#include <cmath>
+
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+Discrete Fourier transform X[k] = sum x[j] exp(-2 pi i jk/n) in
+O(n log n) for any n. When n is a power of two the iterative radix-2
+Cooley-Tukey transform is used directly. Any other n is rewritten as a
+convolution with a chirp (Bluestein's algorithm), and the convolution is
+done with radix-2 transforms of the next power of two at least 2n-1.
+Twiddle factors and the transformed chirp are computed once for each size.
+Bluestein's transform works in a member vector, so one FourierTransform
+must not be used by two threads at once.
+*/
+template<class T>
+class FourierTransform
+{
+  public:
+    /*  Description: Default Constructor, prepares no transform
+        Preconditions: None
+        Postconditions: getSize() == 0
+    */
+    FourierTransform():n(0), length(0) {}
+    
+    
+    /*  Description: Constructor, prepares transforms of length n
+        Preconditions: n > 0
+        Postconditions: forward and inverse transform n elements
+                        throws SizeError if n < 1
+    */
+    explicit FourierTransform(int n):n(0), length(0) { setSize(n); }
+    
+    
+    /*  Description: Setter for size, prepares transforms of length newN
+        Preconditions: newN > 0
+        Postconditions: forward and inverse transform newN elements,
+                        nothing is recomputed when the size is unchanged
+                        throws SizeError if newN < 1
+    */
+    void setSize(int newN);
+    
+    
+    /*  Description: Forward, transforms data in place
+        Preconditions: data has getSize() elements
+        Postconditions: data[k] = sum data[j] exp(-2 pi i jk/n)
+                        throws SizeError if data has the wrong size
+    */
+    void forward(vector<complex<T> >& data) const;
+    
+    
+    /*  Description: Inverse, undoes forward in place
+        Preconditions: data has getSize() elements
+        Postconditions: data[j] = (1/n) sum data[k] exp(2 pi i jk/n)
+                        throws SizeError if data has the wrong size
+    */
+    void inverse(vector<complex<T> >& data) const;
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the length of the transform
+    */
+    int getSize() const { return n; }
+  
+  
+  private:
+    int n;
+    // length of the radix-2 transforms, n itself or the Bluestein length
+    int length;
+    // exp(-2 pi i k/length) for k < length/2
+    vector<complex<T> > twiddles;
+    // exp(-pi i k^2/n) and the transform of its wrapped conjugate, only
+    // used when n is not a power of two
+    vector<complex<T> > chirp;
+    vector<complex<T> > chirpTransform;
+    mutable vector<complex<T> > work;
+    
+    
+    /*  Description: Radix 2, in place transform of length
+        Preconditions: data has length elements
+        Postconditions: data holds its forward transform, or the inverse
+                        without the 1/length scaling when conjugate is true
+    */
+    void radix2(vector<complex<T> >& data, bool conjugate) const;
+    
+    
+    /*  Description: Bluestein, forward transform of any length through a
+                     chirp convolution
+        Preconditions: data has n elements
+        Postconditions: data holds its forward transform
+    */
+    void bluestein(vector<complex<T> >& data) const;
+
+};
+
+#include "FourierTransform.hpp"
+#endif
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*
+  Filename:   FourierTransform.hpp
+  Author:     Raymond Hummel
+  Date:       5/25/2014
+  Purpose:    Contains the implementation of the FourierTransform class
+*/
+
+
+template<class T>
+void FourierTransform<T>::setSize(int newN)
+{
+  if(newN < 1) throw SizeError(newN, "FourierTransform setSize");
+  if(newN == n) return;
+  n = newN;
+  const T pi = acos(T(-1));
+  length = 1;
+  while(length < n) length *= 2;
+  if(length != n)
+  {
+    // the convolution of n values with a chirp of 2n-1 values must not
+    // wrap around
+    length = 1;
+    while(length < 2*n-1) length *= 2;
+  }
+  twiddles.resize(length/2);
+  for(int k=0; k < length/2; k++)
+  {
+    twiddles[k] = polar(T(1), -2*pi*k/length);
+  }
+  if(length != n)
+  {
+    chirp.resize(n);
+    for(int k=0; k < n; k++)
+    {
+      // k^2 mod 2n keeps the angle small for large k
+      long square = (long(k)*k) % (2*n);
+      chirp[k] = polar(T(1), -pi*square/n);
+    }
+    chirpTransform.assign(length, complex<T>(0));
+    chirpTransform[0] = conj(chirp[0]);
+    for(int k=1; k < n; k++)
+    {
+      chirpTransform[k] = conj(chirp[k]);
+      chirpTransform[length-k] = conj(chirp[k]);
+    }
+    radix2(chirpTransform, false);
+    work.resize(length);
+  }
+  else
+  {
+    chirp.clear();
+    chirpTransform.clear();
+    work.clear();
+  }
+}
+
+
+template<class T>
+void FourierTransform<T>::forward(vector<complex<T> >& data) const
+{
+  if(int(data.size()) != n) throw SizeError(data.size(), "FourierTransform forward");
+  if(length == n) radix2(data, false);
+  else bluestein(data);
+}
+
+
+template<class T>
+void FourierTransform<T>::inverse(vector<complex<T> >& data) const
+{
+  if(int(data.size()) != n) throw SizeError(data.size(), "FourierTransform inverse");
+  // the inverse is the forward transform of the conjugate, conjugated
+  for(int k=0; k < n; k++)
+  {
+    data[k] = conj(data[k]);
+  }
+  if(length == n) radix2(data, false);
+  else bluestein(data);
+  for(int k=0; k < n; k++)
+  {
+    data[k] = conj(data[k]) / T(n);
+  }
+}
+
+
+template<class T>
+void FourierTransform<T>::radix2(vector<complex<T> >& data, bool conjugate) const
+{
+  // bit reversed order first, so every stage combines neighbouring blocks
+  for(int i=1, j=0; i < length; i++)
+  {
+    int bit = length >> 1;
+    for(; j & bit; bit >>= 1)
+    {
+      j ^= bit;
+    }
+    j ^= bit;
+    if(i < j) swap(data[i], data[j]);
+  }
+  for(int size=2; size <= length; size *= 2)
+  {
+    int half = size/2;
+    int step = length/size;
+    for(int first=0; first < length; first += size)
+    {
+      for(int k=0; k < half; k++)
+      {
+        complex<T> w = conjugate ? conj(twiddles[k*step]) : twiddles[k*step];
+        complex<T> odd = data[first+k+half] * w;
+        data[first+k+half] = data[first+k] - odd;
+        data[first+k] += odd;
+      }
+    }
+  }
+}
+
+
+template<class T>
+void FourierTransform<T>::bluestein(vector<complex<T> >& data) const
+{
+  // jk = (j^2 + k^2 - (k-j)^2)/2, so the transform is the chirp times the
+  // convolution of the chirped data with the conjugate chirp
+  for(int k=0; k < n; k++)
+  {
+    work[k] = data[k] * chirp[k];
+  }
+  for(int k=n; k < length; k++)
+  {
+    work[k] = 0;
+  }
+  radix2(work, false);
+  for(int k=0; k < length; k++)
+  {
+    work[k] *= chirpTransform[k];
+  }
+  radix2(work, true);
+  for(int k=0; k < n; k++)
+  {
+    data[k] = work[k] * chirp[k] / T(length);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+  Filename:   GMRES.h
+  Author:     Raymond Hummel
+  Date:       5/28/2014
+  Purpose:    Contains the declaration of the GMRES class
+*/
+
+#ifndef GMRES_H
+#define GMRES_H
+
+#include <vector>
+#include <cmath>
+
+#include "MatrixBase.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+Restarted generalized minimal residual method for any nonsingular A.
+Arnoldi's process builds an orthonormal basis of the Krylov space
+b, Ab, A^2b, ... one product with A at a time, using modified
+Gram-Schmidt, and the Hessenberg matrix it leaves behind is reduced to
+triangular form with Givens rotations as it grows. The rotated right side
+then gives the 2-norm of the residual of the best x in the space without
+forming it. Storage and orthogonalization work grow with the basis, so
+after restart steps x is updated, the residual is recomputed and a new
+basis is started from it.
+*/
+template<class T>
+class GMRES
+{
+  public:
+    /*  Description: Constructor, selects the restart length
+        Preconditions: restart > 0
+        Postconditions: each cycle builds at most restart basis vectors
+                        throws RangeError if restart < 1
+    */
+    explicit GMRES(int restart = 30)
+      :restart(restart), iterations(0)
+    {
+      if(restart < 1) throw RangeError(restart, "GMRES restart");
+      hessenberg.resize((restart+1) * restart);
+      cosines.resize(restart);
+      sines.resize(restart);
+      rotated.resize(restart+1);
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is nonsingular
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is nonsingular
+        Postconditions: x holds the approximate solution of Ax=b, workspace
+                        slots 0 through restart hold the last basis
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      Norm<T> norm;
+      int n = b.getSize();
+      workspace.reserve(restart+1, n);
+      double error = 0.0000001;
+      // the Arnoldi residual is a 2-norm, ||r||_1 <= sqrt(n) ||r||_2
+      T basisError = error / sqrt(T(n > 0 ? n : 1));
+      
+      x.setSize(n);
+      x = 0;
+      
+      iterations = 0;
+      
+      while(true)
+      {
+        //true residual at the start of every cycle
+        Vector<T>& r = workspace(0, n);
+        A.multiply(x, r);
+        r = b - r;
+        if(norm(r) <= error) break;
+        T beta = sqrt(r * r);
+        r *= 1 / beta;
+        for(int i=1; i <= restart; i++) rotated[i] = 0;
+        rotated[0] = beta;
+        
+        int steps = 0;
+        while(steps < restart && iterations <= 5000)
+        {
+          int j = steps;
+          Vector<T>& w = workspace(j+1, n);
+          A.multiply(workspace(j, n), w);
+          
+          //orthogonalize against the basis one vector at a time
+          for(int i=0; i <= j; i++)
+          {
+            Vector<T>& v = workspace(i, n);
+            T h = w * v;
+            H(i,j) = h;
+            w -= v * h;
+          }
+          T length = sqrt(w * w);
+          H(j+1,j) = length;
+          
+          //apply the previous rotations to the new column, then zero
+          //its subdiagonal with a new one
+          for(int i=0; i < j; i++)
+          {
+            T upper = H(i,j);
+            T lower = H(i+1,j);
+            H(i,j) = cosines[i]*upper + sines[i]*lower;
+            H(i+1,j) = -sines[i]*upper + cosines[i]*lower;
+          }
+          T diagonal = H(j,j);
+          T radius = sqrt(diagonal*diagonal + length*length);
+          if(radius == T(0)) throw "GMRES broke down, Matrix A is singular";
+          cosines[j] = diagonal / radius;
+          sines[j] = length / radius;
+          H(j,j) = radius;
+          H(j+1,j) = 0;
+          rotated[j+1] = -sines[j] * rotated[j];
+          rotated[j] = cosines[j] * rotated[j];
+          
+          steps++;
+          iterations++;
+          // a zero length means the space holds the exact solution
+          if(abs(rotated[j+1]) <= basisError || length == T(0)) break;
+          w *= 1 / length;
+        }
+        
+        //x += V y where H y = rotated, solved upward in rotated
+        for(int i=steps-1; i >= 0; i--)
+        {
+          T sum = rotated[i];
+          for(int k=i+1; k < steps; k++)
+          {
+            sum -= H(i,k) * rotated[k];
+          }
+          rotated[i] = sum / H(i,i);
+        }
+        for(int i=0; i < steps; i++)
+        {
+          x += workspace(i, n) * rotated[i];
+        }
+        
+        if(iterations > 5000)
+        {
+          cout << "GMRES method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of products with A the last
+                        solve used to build bases
+    */
+    int getIterations() const { return iterations; }
+    
+    
+    /*  Description: Getter for restart
+        Preconditions: None
+        Postconditions: returns the largest basis of one cycle
+    */
+    int getRestart() const { return restart; }
+  
+  
+  private:
+    int restart;
+    int iterations;
+    // (restart+1) x restart Hessenberg matrix, triangular once rotated
+    vector<T> hessenberg;
+    // Givens rotation of each basis step
+    vector<T> cosines;
+    vector<T> sines;
+    // rotated beta e1, the coefficients of the update once solved
+    vector<T> rotated;
+    
+    
+    /*  Description: Hessenberg Access, returns element (i,j)
+        Preconditions: 0 <= i <= restart, 0 <= j < restart
+        Postconditions: returns a reference to the element
+    */
+    T& H(int i, int j) { return hessenberg[i*restart + j]; }
+
+};
+
+#endif
\ No newline at end of file
@@ -8,9 +8,15 @@
 #ifndef GAUSSSEIDEL_H
 #define GAUSSSEIDEL_H
 
+#include <vector>
+#include <cstdlib>
+
 #include "MatrixBase.h"
 #include "Matrix.h"
 #include "Norm.h"
+#include "FixedMatrix.h"
+#include "FixedVector.h"
+#include "SolverWorkspace.h"
 
 template<class T>
 class GaussSeidel
@@ -22,13 +28,30 @@ class GaussSeidel
                         of of Ax=b for x
     */
     Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A has no element Aii == 0
+        Postconditions: x holds the approximate solution of Ax=b
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
     {
       int n = A.getNumCols();
-      Vector<T> x(n);
-      Vector<T> prevX(n);
+      x.setSize(n);
+      Vector<T>& prevX = workspace(0, n);
       Norm<T> norm;
       int count = 0;
-      T sum;
+      T sum, diagonal;
       
       x = 0;
       prevX = 1;
@@ -38,23 +61,132 @@ class GaussSeidel
         prevX = x;
         for(int i=0; i < n; i++)
         {
-          sum = 0;
-          for(int j=0; j <= i-1; j++)
+          // x already holds the new values before i and the previous
+          // values after i, so one row product covers both sums
+          diagonal = A(i,i);
+          sum = b[i] - (A.rowProduct(i,x) - diagonal*x[i]);
+          x[i] = (1/diagonal)*sum;
+        }
+        count++;
+      }
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves AX=B for every
+                     column of B in one pass, each sweep reads a row of A
+                     once and updates that row of every column still
+                     being solved
+        Preconditions: A has no element Aii == 0, B has A.getNumRows()
+                       rows
+        Postconditions: column c of X holds the approximate solution of
+                        Ax=b for column c of B, taking the same sweeps as
+                        a solve of that column alone
+                        throws SizeError if B does not match A
+    */
+    void operator()(const MatrixBase<T>& A, const Matrix<T>& B, Matrix<T>& X)
+    {
+      int n = A.getNumCols();
+      int k = B.getNumCols();
+      if(B.getNumRows() != A.getNumRows()) throw SizeError(B.getNumRows(), "GaussSeidel right-hand sides");
+      X = Matrix<T>(n, k);
+      // the columns still iterating are packed side by side, so the
+      // update of one row runs along contiguous memory, and active[c] is
+      // the column of X that packed column c belongs to
+      vector<int> active(k);
+      vector<T> work(n*k, T(0)), rhs(n*k), changes(k);
+      for(int c=0; c < k; c++) active[c] = c;
+      for(int i=0; i < n; i++)
+      {
+        for(int c=0; c < k; c++) rhs[i*k + c] = B.data()[i*k + c];
+      }
+      vector<int> columns;
+      vector<T> values;
+      vector<T> sums(k);
+      int width = k;
+      
+      while(width > 0)
+      {
+        for(int c=0; c < width; c++) changes[c] = 0;
+        for(int i=0; i < n; i++)
+        {
+          A.getRowNonzeros(i, columns, values);
+          T diagonal = A(i,i);
+          T* row = &work[i*width];
+          // the sums include the diagonal, like rowProduct does for a
+          // single column
+          for(int c=0; c < width; c++) sums[c] = 0;
+          for(int e=0; e < int(columns.size()); e++)
           {
-            sum -= A(i,j)*x[j];
+            const T a = values[e];
+            const T* other = &work[columns[e]*width];
+            for(int c=0; c < width; c++) sums[c] += a * other[c];
           }
-          for(int j=i+1; j < n; j++)
+          for(int c=0; c < width; c++)
           {
-            sum -= A(i,j)*prevX[j];
+            T next = (1/diagonal)*(rhs[i*width + c] - (sums[c] - diagonal*row[c]));
+            changes[c] += abs(next - row[c]);
+            row[c] = next;
           }
-          sum += b[i];
-          x[i] = (1/A(i,i))*sum;
         }
-        count++;
+        
+        //finished columns go to X and the rest are packed again
+        int kept = 0;
+        for(int c=0; c < width; c++)
+        {
+          if(changes[c] > 0.0000001)
+          {
+            active[kept++] = active[c];
+            continue;
+          }
+          for(int i=0; i < n; i++) X.data()[i*k + active[c]] = work[i*width + c];
+        }
+        if(kept < width)
+        {
+          for(int i=0; i < n; i++)
+          {
+            int to = 0;
+            for(int c=0; c < width; c++)
+            {
+              if(changes[c] <= 0.0000001) continue;
+              work[i*kept + to] = work[i*width + c];
+              rhs[i*kept + to] = rhs[i*width + c];
+              to++;
+            }
+          }
+          width = kept;
+        }
       }
-      return x;
     }
     
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+                     for a system whose size is known at compile time,
+                     every vector lives on the stack
+        Preconditions: A has no element Aii == 0
+        Postconditions: returns FixedVector representing the approximate
+                        solution of Ax=b for x
+    */
+    template<int N>
+    FixedVector<T,N> operator()(const FixedMatrix<T,N,N>& A, const FixedVector<T,N>& b)
+    {
+      FixedVector<T,N> x(T(0));
+      FixedVector<T,N> prevX(T(1));
+      Norm<T> norm;
+      T sum, diagonal;
+      
+      while(norm(x - prevX) > 0.0000001)
+      {
+        prevX = x;
+        for(int i=0; i < N; i++)
+        {
+          diagonal = A(i,i);
+          sum = b[i] - (A.rowProduct(i,x) - diagonal*x[i]);
+          x[i] = (1/diagonal)*sum;
+        }
+      }
+      return x;
+    }
+
 };
 
 #endif
\ No newline at end of file
@@ -16,6 +16,9 @@
 #include "MatrixBase.h"
 #include "Matrix.h"
 #include "Vector.h"
+#include "LUFactorization.h"
+#include "FixedMatrix.h"
+#include "FixedVector.h"
 
 
 template<class T>
@@ -23,44 +26,31 @@ class GaussianElimination
 {
   public:
     /*  Description: Function Evaluation Operator, performs Gaussian 
-                     Elimination to solve the equation Ax=b
+                     Elimination to solve the equation Ax=b, through a
+                     blocked LU factorization with partial pivoting
         Preconditions: A must be a square matrix
                        T must have a properly defined division operator
-                       T must be convertible to a float
                        T must have an overload for the abs() function
         Postconditions: x contains the solution the equation Ax=b
                         throws a SizeError if A.numRows != b.size
+                        throws if A is singular
     */
-    Vector<T> operator()(MatrixBase<T>& A, const Vector<T>& b);
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b);
     
     
-  private:
-    /*  Description: Reduce Down, reduces all elements in A below the
-                     start position to zero
-        Preconditions: 1 <= start < numRows in A
-        Postconditions: the column referenced by start - 1 is all zeros 
-                        from row start to numRows-1
-    */
-    void reduceDown(Matrix<T>& A, int start);
-    
-    
-    /*  Description: Reduce Up, reduces all elements in A above the
-                     start position to zero
-        Preconditions: 0 < start <= numRows-2 in A
-        Postconditions: the column referenced by start + 1 is all zeros
-                        from row start to row 0
-    */
-    void reduceUp(Matrix<T>& A, int start);
-    
-    
-    /*  Description: Swap, swaps the current row with the row that has the 
-                     largest absolute valued element in the column
-        Preconditions: T must overload the abs() function
-        Postconditions: A[row][col] contains the largest element of A[>=row][col]
+    /*  Description: Function Evaluation Operator, performs Gaussian 
+                     Elimination with partial pivoting on a system whose
+                     size is known at compile time, all work is done in
+                     stack storage
+        Preconditions: A must not be singular
+                       T must have a properly defined division operator
+                       T must have an overload for the abs() function
+        Postconditions: returns x, the solution the equation Ax=b
+                        throws if a zero pivot is found
     */
-    void swap(Matrix<T>& A, int row, int col);
-    
-    
+    template<int N>
+    FixedVector<T,N> operator()(const FixedMatrix<T,N,N>& A, const FixedVector<T,N>& b);
+
 };
 
 #include "GaussianElimination.hpp"
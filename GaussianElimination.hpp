@@ -7,81 +7,76 @@
 
 
 template<class T>
-Vector<T> GaussianElimination<T>::operator()(MatrixBase<T>& A, const Vector<T>& b)
+Vector<T> GaussianElimination<T>::operator()(const MatrixBase<T>& A, const Vector<T>& b)
 {
-  Vector<T> x( b.getSize() );
-  
-  Matrix<T> newA(A.getNumRows(),A.getNumCols());
-  newA = A;
-  newA.addColumn(b);
-  
-  // Forward Elimination
-  for(int i=1; i < newA.getNumRows(); i++)
-  {
-    reduceDown(newA, i);
-  }
-  // Backward Elimination
-  for(int i=newA.getNumRows()-2; i >= 0; i--)
-  {
-    reduceUp(newA, i);
-  }
-  // Solve for x
-  for(int i=0; i < x.getSize(); i++)
-  {
-    x[i] = newA(i,newA.getNumCols()-1) / newA(i,i);
-  }
-  
-  return x;
+  if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "GaussianElimination");
+  LUFactorization<T> factors(A);
+  return factors.solve(b);
 }
 
 
 template<class T>
-void GaussianElimination<T>::reduceDown(Matrix<T>& A, int start)
+template<int N>
+FixedVector<T,N> GaussianElimination<T>::operator()(const FixedMatrix<T,N,N>& A, const FixedVector<T,N>& b)
 {
-  double coeff;
-  float tolerance = 0.01;
-  T pivot = A(start-1,start-1);
-  if( pivot < tolerance && pivot > -tolerance ) swap(A, start-1, start-1);
-  for(int i=start; i < A.getNumRows(); i++)
+  FixedMatrix<T,N,N> newA(A);
+  FixedVector<T,N> x(b);
+  
+  // Forward Elimination, b is reduced along with A. Only the columns from
+  // k on are swapped and updated, the back substitution never reads the
+  // entries below the diagonal
+  FIXED_UNROLL
+  for(int k=0; k < N; k++)
   {
-    coeff = -(A(i,start-1) / A(start-1,start-1));
-    for(int j=0; j < A.getNumCols(); j++)
+    int maxIndex = k;
+    T maxValue = abs(newA(k,k));
+    FIXED_UNROLL
+    for(int i=k+1; i < N; i++)
     {
-      A(i,j) += A(start-1,j) * coeff;
+      if( abs(newA(i,k)) > maxValue )
+      {
+        maxIndex = i;
+        maxValue = abs(newA(i,k));
+      }
     }
-  }
-}
-
-
-template<class T>
-void GaussianElimination<T>::reduceUp(Matrix<T>& A, int start)
-{
-  double coeff;
-  for(int i=start; i >= 0; i--)
-  {
-    coeff = -(A(i,start+1) / A(start+1,start+1));
-    for(int j=0; j < A.getNumCols(); j++)
+    if(maxIndex != k)
     {
-      A(i,j) += A(start+1,j) * coeff;
+      FIXED_UNROLL
+      for(int j=k; j < N; j++)
+      {
+        T temp = newA(k,j);
+        newA(k,j) = newA(maxIndex,j);
+        newA(maxIndex,j) = temp;
+      }
+      T temp = x[k];
+      x[k] = x[maxIndex];
+      x[maxIndex] = temp;
+    }
+    if( newA(k,k) == T(0) ) throw "Matrix A is singular";
+    FIXED_UNROLL
+    for(int i=k+1; i < N; i++)
+    {
+      T coeff = -(newA(i,k) / newA(k,k));
+      FIXED_UNROLL
+      for(int j=k+1; j < N; j++)
+      {
+        newA(i,j) += newA(k,j) * coeff;
+      }
+      x[i] += x[k] * coeff;
     }
   }
-}
-
-
-template<class T>
-void GaussianElimination<T>::swap(Matrix<T>& A, int row, int col)
-{
-  Vector<T> column;
-  column = A.getColumn(col);
-  T max = 0;
-  int maxIndex;
-  for(int i=row; i < A.getNumRows(); i++)
+  // Solve for x from the bottom row up
+  FIXED_UNROLL
+  for(int i=N-1; i >= 0; i--)
   {
-    if( abs(column[i]) > max )
+    T sum = x[i];
+    FIXED_UNROLL
+    for(int j=i+1; j < N; j++)
     {
-      max = column[i];
-      maxIndex = i;
+      sum -= newA(i,j) * x[j];
     }
+    x[i] = sum / newA(i,i);
   }
-  A.swapRows(row, maxIndex);
+  
+  return x;
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+/*
+  Filename:   IncompleteCholesky.h
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the declaration of the IncompleteCholesky class
+*/
+
+#ifndef INCOMPLETECHOLESKY_H
+#define INCOMPLETECHOLESKY_H
+
+#include <vector>
+#include <cmath>
+
+#include "Preconditioner.h"
+#include "SymmetricMatrix.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+IC(0) factors A as U^T U where U is upper triangular and is only allowed
+nonzeros where the upper triangle of A has them, so the factor is no
+larger than A. The rows of U are kept in compressed form, the same layout
+SparseMatrix uses. A SymmetricMatrix is read straight out of its packed
+upper triangle, any other matrix through getRowNonzeros.
+*/
+template<class T>
+class IncompleteCholesky: public Preconditioner<T>
+{
+  public:
+    /*  Description: Constructor, factors A
+        Preconditions: A is symmetric positive definite
+        Postconditions: apply solves U^T U z = r
+                        throws if the factorization breaks down
+    */
+    explicit IncompleteCholesky(const MatrixBase<T>& A) { setup(A); }
+    
+    
+    /*  Description: Setup, computes the incomplete factor of A
+        Preconditions: A is symmetric positive definite
+        Postconditions: apply solves U^T U z = r
+                        throws if A is not symmetric or a pivot is not
+                        positive
+    */
+    virtual void setup(const MatrixBase<T>& A);
+    
+    
+    /*  Description: Apply, solves U^T U z = r with a forward and a 
+                     backward substitution
+        Preconditions: r has getSize() elements
+        Postconditions: z = (U^T U)^-1 r
+    */
+    virtual void apply(const Vector<T>& r, Vector<T>& z) const;
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the matrix
+    */
+    virtual int getSize() const { return rowStart.size() - 1; }
+    
+    
+    /*  Description: Getter for the number of stored elements
+        Preconditions: None
+        Postconditions: returns the number of nonzeros in U
+    */
+    int getNumNonzeros() const { return values.size(); }
+  
+  
+  private:
+    // row i of U is columnIndex/values[rowStart[i]] up to rowStart[i+1],
+    // columns increase along a row and the first one is the diagonal
+    vector<int> rowStart;
+    vector<int> columnIndex;
+    vector<T> values;
+    
+    
+    /*  Description: Gather, copies the upper triangle of A into the
+                     compressed rows
+        Preconditions: A is square
+        Postconditions: rows hold every nonzero Aij with j >= i and the
+                        diagonal, even when it is zero
+    */
+    void gather(const MatrixBase<T>& A);
+    
+    
+    /*  Description: Factor, overwrites the compressed rows with U
+        Preconditions: gather has been called
+        Postconditions: rows hold U
+                        throws if a pivot is not positive
+    */
+    void factor();
+    
+    
+    /*  Description: Find, locates an element of U
+        Preconditions: 0 <= row < getSize()
+        Postconditions: returns the position of (row,col) in values or -1
+                        if it is not stored
+    */
+    int find(int row, int col) const;
+
+};
+
+#include "IncompleteCholesky.hpp"
+#endif
@@ -0,0 +1,134 @@
+/*
+  Filename:   IncompleteCholesky.hpp
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the implementation of the IncompleteCholesky class
+*/
+
+#include <algorithm>
+
+
+template<class T>
+void IncompleteCholesky<T>::setup(const MatrixBase<T>& A)
+{
+  if(A.getNumRows() != A.getNumCols()) throw SizeError(A.getNumCols(), "IncompleteCholesky");
+  if( !A.symmetric() ) throw "Matrix A must be symmetric";
+  gather(A);
+  factor();
+}
+
+
+template<class T>
+void IncompleteCholesky<T>::apply(const Vector<T>& r, Vector<T>& z) const
+{
+  int n = getSize();
+  if(r.getSize() != n) throw SizeError(r.getSize(), "IncompleteCholesky apply");
+  z.setSize(n);
+  z = r;
+  // forward substitution with U^T, row k of U is column k of U^T
+  for(int k=0; k < n; k++)
+  {
+    z[k] = z[k] / values[rowStart[k]];
+    for(int p=rowStart[k]+1; p < rowStart[k+1]; p++)
+    {
+      z[columnIndex[p]] -= values[p] * z[k];
+    }
+  }
+  // backward substitution with U
+  for(int k=n-1; k >= 0; k--)
+  {
+    T sum = z[k];
+    for(int p=rowStart[k]+1; p < rowStart[k+1]; p++)
+    {
+      sum -= values[p] * z[columnIndex[p]];
+    }
+    z[k] = sum / values[rowStart[k]];
+  }
+}
+
+
+template<class T>
+void IncompleteCholesky<T>::gather(const MatrixBase<T>& A)
+{
+  int n = A.getNumRows();
+  rowStart.assign(1, 0);
+  columnIndex.clear();
+  values.clear();
+  const SymmetricMatrix<T>* packed = dynamic_cast<const SymmetricMatrix<T>*>(&A);
+  vector<int> rowColumns;
+  vector<T> rowValues;
+  for(int i=0; i < n; i++)
+  {
+    // the diagonal is always kept, it holds the pivot
+    columnIndex.push_back(i);
+    if(packed)
+    {
+      // row i of the packed triangle is (i,i) through (i,n-1)
+      const T* row = packed->data() + size_t(i)*(2*size_t(n) - i + 1)/2;
+      values.push_back(row[0]);
+      for(int j=i+1; j < n; j++)
+      {
+        if(row[j-i] != T(0))
+        {
+          columnIndex.push_back(j);
+          values.push_back(row[j-i]);
+        }
+      }
+    }
+    else
+    {
+      A.getRowNonzeros(i, rowColumns, rowValues);
+      values.push_back(0);
+      for(unsigned int k=0; k < rowColumns.size(); k++)
+      {
+        if(rowColumns[k] == i) values.back() = rowValues[k];
+        else if(rowColumns[k] > i)
+        {
+          columnIndex.push_back(rowColumns[k]);
+          values.push_back(rowValues[k]);
+        }
+      }
+    }
+    rowStart.push_back(columnIndex.size());
+  }
+}
+
+
+template<class T>
+void IncompleteCholesky<T>::factor()
+{
+  int n = getSize();
+  for(int k=0; k < n; k++)
+  {
+    T pivot = values[rowStart[k]];
+    if( !(pivot > 0) ) throw "IncompleteCholesky pivot is not positive";
+    T diagonal = sqrt(pivot);
+    for(int p=rowStart[k]; p < rowStart[k+1]; p++)
+    {
+      values[p] = values[p] / diagonal;
+    }
+    values[rowStart[k]] = diagonal;
+    // subtract the outer product of row k from the rows below, dropping
+    // every update that falls outside the pattern of A
+    for(int p=rowStart[k]+1; p < rowStart[k+1]; p++)
+    {
+      int i = columnIndex[p];
+      for(int q=p; q < rowStart[k+1]; q++)
+      {
+        int position = find(i, columnIndex[q]);
+        if(position >= 0) values[position] -= values[p] * values[q];
+      }
+    }
+  }
+}
+
+
+template<class T>
+int IncompleteCholesky<T>::find(int row, int col) const
+{
+  vector<int>::const_iterator first = columnIndex.begin() + rowStart[row];
+  vector<int>::const_iterator last = columnIndex.begin() + rowStart[row+1];
+  vector<int>::const_iterator pos = lower_bound(first, last, col);
+  if(pos == last || *pos != col) return -1;
+  return pos - columnIndex.begin();
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+  Filename:   Jacobi.h
+  Author:     Raymond Hummel
+  Date:       5/26/2014
+  Purpose:    Contains the declaration of the Jacobi class
+*/
+
+#ifndef JACOBI_H
+#define JACOBI_H
+
+#include <vector>
+#include <cstdlib>
+
+#include "MatrixBase.h"
+#include "Vector.h"
+#include "SolverWorkspace.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+
+/*
+Jacobi finds every new value from the previous iterate only, so the rows
+of a sweep are independent. The rows are split into one contiguous block
+per thread of a ThreadPool, each block writes its new values into a
+second vector and sums how far they moved, and the two vectors are
+swapped after the sweep instead of copied. A weight below 1 damps each
+step, which makes Jacobi a smoother.
+*/
+template<class T>
+class Jacobi
+{
+  public:
+    /*  Description: Constructor, starts the thread pool
+        Preconditions: 0 < weight <= 1
+        Postconditions: sweeps run on numThreads threads, numThreads < 1
+                        uses one thread per hardware core, every step is
+                        scaled by weight
+    */
+    Jacobi(int numThreads = 0, const T& weight = 1)
+      :pool(numThreads), changes(pool.getNumThreads()), weight(weight), iterations(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is diagonally dominant
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is diagonally dominant
+        Postconditions: x holds the approximate solution of Ax=b, sweeps
+                        stop once a sweep changes x by less than 0.0000001
+                        throws if A and b do not match or Aii == 0
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      const int n = b.getSize();
+      Vector<T>& next = workspace(0, n);
+      Vector<T>& diagonal = workspace(1, n);
+      for(int i=0; i < n; i++)
+      {
+        diagonal[i] = A(i,i);
+        if(diagonal[i] == T(0)) throw "Jacobi needs a nonzero diagonal";
+      }
+      x.setSize(n);
+      x = 0;
+      const int numBlocks = pool.getNumThreads() < n ? pool.getNumThreads() : n;
+      
+      // block k finds the rows [k*n/numBlocks, (k+1)*n/numBlocks) of the
+      // next iterate and records how far they moved in changes[k]
+      function<void(int)> sweepBlock = [&](int k)
+      {
+        T change = 0;
+        for(int i=k*n/numBlocks; i < (k+1)*n/numBlocks; i++)
+        {
+          // the row product includes the diagonal, so b - Ax is the residual
+          T step = weight * (b[i] - A.rowProduct(i,x)) / diagonal[i];
+          next[i] = x[i] + step;
+          change += abs(step);
+        }
+        changes[k] = change;
+      };
+      
+      T change = 1;
+      iterations = 0;
+      while(change > 0.0000001)
+      {
+        pool.run(numBlocks, sweepBlock);
+        x.swap(next);
+        change = 0;
+        for(int k=0; k < numBlocks; k++) change += changes[k];
+        iterations++;
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of sweeps the last solve took
+    */
+    int getIterations() const { return iterations; }
+    
+    
+    /*  Description: Getter for the number of threads
+        Preconditions: None
+        Postconditions: returns the threads a sweep is split across
+    */
+    int getNumThreads() const { return pool.getNumThreads(); }
+  
+  
+  private:
+    ThreadPool pool;
+    // change of each block during the current sweep, kept apart so the
+    // blocks never write to the same element
+    vector<T> changes;
+    T weight;
+    int iterations;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+  Filename:   JacobiPreconditioner.h
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the definition and implementation of the 
+              JacobiPreconditioner class
+*/
+
+#ifndef JACOBIPRECONDITIONER_H
+#define JACOBIPRECONDITIONER_H
+
+#include "Preconditioner.h"
+#include "Error.h"
+
+
+/*
+Jacobi preconditioning uses only the diagonal of A, M = D, so applying
+it is one multiplication per element.
+*/
+template<class T>
+class JacobiPreconditioner: public Preconditioner<T>
+{
+  public:
+    /*  Description: Constructor, builds the preconditioner for A
+        Preconditions: A has no element Aii == 0
+        Postconditions: apply divides by the diagonal of A
+    */
+    explicit JacobiPreconditioner(const MatrixBase<T>& A) { setup(A); }
+    
+    
+    /*  Description: Setup, stores the inverse of the diagonal of A
+        Preconditions: A has no element Aii == 0
+        Postconditions: apply divides by the diagonal of A
+                        throws if a diagonal element is zero
+    */
+    virtual void setup(const MatrixBase<T>& A)
+    {
+      if(A.getNumRows() != A.getNumCols()) throw SizeError(A.getNumCols(), "JacobiPreconditioner");
+      inverseDiagonal.setSize(A.getNumRows());
+      for(int i=0; i < A.getNumRows(); i++)
+      {
+        if(A(i,i) == T(0)) throw "JacobiPreconditioner needs a nonzero diagonal";
+        inverseDiagonal[i] = 1/A(i,i);
+      }
+    }
+    
+    
+    /*  Description: Apply, solves Dz = r
+        Preconditions: r has getSize() elements
+        Postconditions: z = D^-1 r
+    */
+    virtual void apply(const Vector<T>& r, Vector<T>& z) const
+    {
+      if(r.getSize() != getSize()) throw SizeError(r.getSize(), "JacobiPreconditioner apply");
+      z.setSize(getSize());
+      for(int i=0; i < getSize(); i++)
+      {
+        z[i] = inverseDiagonal[i] * r[i];
+      }
+    }
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the matrix
+    */
+    virtual int getSize() const { return inverseDiagonal.getSize(); }
+  
+  
+  private:
+    Vector<T> inverseDiagonal;
+
+};
+
+#endif
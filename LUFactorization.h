@@ -0,0 +1,168 @@
+/*
+  Filename:   LUFactorization.h
+  Author:     Raymond Hummel
+  Date:       5/24/2014
+  Purpose:    Contains the declaration of the LUFactorization class
+*/
+
+#ifndef LUFACTORIZATION_H
+#define LUFACTORIZATION_H
+
+#include <vector>
+#include <cstdlib>
+#include <cmath>
+
+#include "MatrixBase.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+Factors a square A as PA = LU with partial pivoting, L unit lower and U
+upper triangular, both kept in the row-major storage of one Matrix. The
+factorization is right-looking and blocked: a panel of LU_PANEL_SIZE
+columns is factored on its own, then the rows of U to its right are found
+and the trailing matrix is updated with the product of the two. That
+update holds nearly all the work, it is done in 4x4 tiles that stay in
+registers while the whole panel width is summed, so every element loaded
+is used four times. Once factored, every
+solve is a permutation and two triangular substitutions, O(n^2).
+*/
+template<class T>
+class LUFactorization
+{
+  public:
+    /*  Description: Default Constructor, holds no factor
+        Preconditions: None
+        Postconditions: getSize() == 0
+    */
+    LUFactorization() {}
+    
+    
+    /*  Description: Constructor, factors a copy of A
+        Preconditions: A is square and not singular
+        Postconditions: solve uses the factors of A
+                        throws SizeError if A is not square, throws if a
+                        zero pivot is found
+    */
+    explicit LUFactorization(const MatrixBase<T>& A) { factor(A); }
+    
+    
+    /*  Description: Move Constructor, factors A in its own storage
+        Preconditions: A is square and not singular
+        Postconditions: solve uses the factors of A, A is left empty
+                        throws SizeError if A is not square, throws if a
+                        zero pivot is found
+    */
+    explicit LUFactorization(Matrix<T>&& A) { factor(move(A)); }
+    
+    
+    /*  Description: Factor, replaces the factors with those of a copy of A
+        Preconditions: A is square and not singular
+        Postconditions: solve uses the factors of A
+                        throws SizeError if A is not square, throws if a
+                        zero pivot is found
+    */
+    void factor(const MatrixBase<T>& A);
+    
+    
+    /*  Description: Factor, replaces the factors with those of A, computed
+                     in the storage of A without a copy
+        Preconditions: A is square and not singular
+        Postconditions: solve uses the factors of A, A is left empty
+                        throws SizeError if A is not square, throws if a
+                        zero pivot is found
+    */
+    void factor(Matrix<T>&& A);
+    
+    
+    /*  Description: Solve, returns the solution of Ax=b
+        Preconditions: a matrix has been factored
+        Postconditions: returns x with Ax = b
+                        throws SizeError if b does not match the factors
+    */
+    Vector<T> solve(const Vector<T>& b) const;
+    
+    
+    /*  Description: Solve, finds the solution of Ax=b without allocating
+                     when x already has the size of b
+        Preconditions: a matrix has been factored, x is not b
+        Postconditions: x holds the solution of Ax=b
+                        throws SizeError if b does not match the factors
+    */
+    void solve(const Vector<T>& b, Vector<T>& x) const;
+    
+    
+    /*  Description: Solve, solves for every column of B at once, each step
+                     of the substitutions works on whole rows of B
+        Preconditions: a matrix has been factored
+        Postconditions: returns X with AX = B
+                        throws SizeError if B does not match the factors
+    */
+    Matrix<T> solve(const Matrix<T>& B) const;
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the factored matrix
+    */
+    int getSize() const { return LU.getNumRows(); }
+    
+    
+    /*  Description: Getter for the factors
+        Preconditions: None
+        Postconditions: returns L below the diagonal, without its unit
+                        diagonal, and U on and above it
+    */
+    const Matrix<T>& getFactors() const { return LU; }
+    
+    
+    /*  Description: Getter for the pivots
+        Preconditions: None
+        Postconditions: returns the row swaps, row k was swapped with row
+                        pivots[k] while column k was eliminated
+    */
+    const vector<int>& getPivots() const { return pivots; }
+  
+  
+  private:
+    Matrix<T> LU;
+    vector<int> pivots;
+    // rows of U right of the current panel, copied in groups of four
+    // columns for the trailing update
+    vector<T> packed;
+    
+    
+    /*  Description: Decompose, overwrites LU with its factors
+        Preconditions: LU holds a square matrix
+        Postconditions: LU holds L and U, pivots holds the row swaps
+                        throws if a zero pivot is found
+    */
+    void decompose();
+    
+    
+    /*  Description: Factor Panel, unblocked elimination of the columns
+                     start to end-1 in the rows below start, swapping whole
+                     rows
+        Preconditions: the columns before start are factored
+        Postconditions: the panel holds its part of L and U
+                        throws if a zero pivot is found
+    */
+    void factorPanel(int start, int end);
+    
+    
+    /*  Description: Update Trailing, finds the rows of U right of the
+                     panel and subtracts L times them from the rows below
+        Preconditions: the panel start to end-1 is factored
+        Postconditions: the rows and columns from end on hold what is
+                        left to factor
+    */
+    void updateTrailing(int start, int end);
+
+};
+
+#include "LUFactorization.hpp"
+#endif
\ No newline at end of file
@@ -0,0 +1,289 @@
+/*
+  Filename:   LUFactorization.hpp
+  Author:     Raymond Hummel
+  Date:       5/24/2014
+  Purpose:    Contains the implementation of the LUFactorization class
+*/
+
+
+// columns factored together as one panel
+const int LU_PANEL_SIZE = 64;
+// columns of the trailing matrix updated together, a panel's rows of U
+// for this many columns stay in cache while every row below uses them
+const int LU_UPDATE_COLUMNS = 256;
+
+
+template<class T>
+void LUFactorization<T>::factor(const MatrixBase<T>& A)
+{
+  if(A.getNumRows() != A.getNumCols()) throw SizeError(A.getNumCols(), "LUFactorization");
+  LU.setSize(A.getNumRows(), A.getNumCols());
+  LU = A;
+  decompose();
+}
+
+
+template<class T>
+void LUFactorization<T>::factor(Matrix<T>&& A)
+{
+  if(A.getNumRows() != A.getNumCols()) throw SizeError(A.getNumCols(), "LUFactorization");
+  LU = move(A);
+  decompose();
+}
+
+
+template<class T>
+Vector<T> LUFactorization<T>::solve(const Vector<T>& b) const
+{
+  Vector<T> x;
+  solve(b, x);
+  return x;
+}
+
+
+template<class T>
+void LUFactorization<T>::solve(const Vector<T>& b, Vector<T>& x) const
+{
+  int n = getSize();
+  if(b.getSize() != n) throw SizeError(b.getSize(), "LUFactorization solve");
+  x.setSize(n);
+  x = b;
+  T* y = x.data();
+  const T* a = LU.data();
+  for(int k=0; k < n; k++)
+  {
+    if(pivots[k] != k)
+    {
+      T temp = y[k];
+      y[k] = y[pivots[k]];
+      y[pivots[k]] = temp;
+    }
+  }
+  // forward substitution with L, its diagonal is one
+  for(int i=0; i < n; i++)
+  {
+    const T* row = a + i*n;
+    T sum = y[i];
+    for(int j=0; j < i; j++)
+    {
+      sum -= row[j] * y[j];
+    }
+    y[i] = sum;
+  }
+  // backward substitution with U
+  for(int i=n-1; i >= 0; i--)
+  {
+    const T* row = a + i*n;
+    T sum = y[i];
+    for(int j=i+1; j < n; j++)
+    {
+      sum -= row[j] * y[j];
+    }
+    y[i] = sum / row[i];
+  }
+}
+
+
+template<class T>
+Matrix<T> LUFactorization<T>::solve(const Matrix<T>& B) const
+{
+  int n = getSize();
+  if(B.getNumRows() != n) throw SizeError(B.getNumRows(), "LUFactorization solve");
+  Matrix<T> X(B);
+  const int m = X.getNumCols();
+  T* x = X.data();
+  const T* a = LU.data();
+  for(int k=0; k < n; k++)
+  {
+    if(pivots[k] != k) X.swapRows(k, pivots[k]);
+  }
+  // forward substitution with L
+  for(int i=0; i < n; i++)
+  {
+    const T* row = a + i*n;
+    T* rowX = x + i*m;
+    for(int j=0; j < i; j++)
+    {
+      T coeff = row[j];
+      if(coeff == T(0)) continue;
+      const T* solved = x + j*m;
+      for(int c=0; c < m; c++)
+      {
+        rowX[c] -= coeff * solved[c];
+      }
+    }
+  }
+  // backward substitution with U
+  for(int i=n-1; i >= 0; i--)
+  {
+    const T* row = a + i*n;
+    T* rowX = x + i*m;
+    for(int j=i+1; j < n; j++)
+    {
+      T coeff = row[j];
+      if(coeff == T(0)) continue;
+      const T* solved = x + j*m;
+      for(int c=0; c < m; c++)
+      {
+        rowX[c] -= coeff * solved[c];
+      }
+    }
+    for(int c=0; c < m; c++)
+    {
+      rowX[c] = rowX[c] / row[i];
+    }
+  }
+  return X;
+}
+
+
+template<class T>
+void LUFactorization<T>::decompose()
+{
+  int n = getSize();
+  pivots.assign(n, 0);
+  for(int start=0; start < n; start += LU_PANEL_SIZE)
+  {
+    int end = start + LU_PANEL_SIZE < n ? start + LU_PANEL_SIZE : n;
+    factorPanel(start, end);
+    if(end < n) updateTrailing(start, end);
+  }
+}
+
+
+template<class T>
+void LUFactorization<T>::factorPanel(int start, int end)
+{
+  int n = getSize();
+  T* a = LU.data();
+  for(int k=start; k < end; k++)
+  {
+    int pivot = k;
+    T largest = abs(a[k*n + k]);
+    for(int i=k+1; i < n; i++)
+    {
+      if( abs(a[i*n + k]) > largest )
+      {
+        largest = abs(a[i*n + k]);
+        pivot = i;
+      }
+    }
+    if(largest == T(0)) throw "Matrix A is singular";
+    pivots[k] = pivot;
+    // the whole row moves, so the finished columns of L and the columns
+    // right of the panel stay with their row
+    if(pivot != k) LU.swapRows(k, pivot);
+    const T* rowK = a + k*n;
+    for(int i=k+1; i < n; i++)
+    {
+      T* row = a + i*n;
+      row[k] = row[k] / rowK[k];
+      T coeff = row[k];
+      if(coeff == T(0)) continue;
+      for(int j=k+1; j < end; j++)
+      {
+        row[j] -= coeff * rowK[j];
+      }
+    }
+  }
+}
+
+
+template<class T>
+void LUFactorization<T>::updateTrailing(int start, int end)
+{
+  int n = getSize();
+  T* a = LU.data();
+  // rows of U right of the panel, forward substitution with the unit
+  // lower triangle of the panel
+  for(int i=start+1; i < end; i++)
+  {
+    T* row = a + i*n;
+    for(int p=start; p < i; p++)
+    {
+      T coeff = row[p];
+      const T* rowP = a + p*n;
+      for(int j=end; j < n; j++)
+      {
+        row[j] -= coeff * rowP[j];
+      }
+    }
+  }
+  // trailing matrix minus L times U, computed in 4x4 tiles that stay in
+  // registers for the whole panel width, the rows of U for a block of
+  // columns are first copied so each tile reads them contiguously
+  const int width = end - start;
+  packed.resize(width * LU_UPDATE_COLUMNS);
+  for(int first=end; first < n; first += LU_UPDATE_COLUMNS)
+  {
+    int last = first + LU_UPDATE_COLUMNS < n ? first + LU_UPDATE_COLUMNS : n;
+    // columns first+4q to first+4q+3 of the panel rows go to
+    // packed[4*width*q], one group of four per row
+    int tiled = first + (last-first)/4*4;
+    for(int j=first; j < tiled; j += 4)
+    {
+      T* tile = &packed[(j-first)*width];
+      for(int p=start; p < end; p++)
+      {
+        const T* rowP = a + p*n + j;
+        tile[0] = rowP[0];
+        tile[1] = rowP[1];
+        tile[2] = rowP[2];
+        tile[3] = rowP[3];
+        tile += 4;
+      }
+    }
+    int i = end;
+    for(; i+3 < n; i += 4)
+    {
+      const T* coeffs[4] = { a + i*n + start, a + (i+1)*n + start,
+                             a + (i+2)*n + start, a + (i+3)*n + start };
+      for(int j=first; j < tiled; j += 4)
+      {
+        const T* tile = &packed[(j-first)*width];
+        T sum00 = 0, sum01 = 0, sum02 = 0, sum03 = 0;
+        T sum10 = 0, sum11 = 0, sum12 = 0, sum13 = 0;
+        T sum20 = 0, sum21 = 0, sum22 = 0, sum23 = 0;
+        T sum30 = 0, sum31 = 0, sum32 = 0, sum33 = 0;
+        for(int p=0; p < width; p++)
+        {
+          T u0 = tile[4*p];
+          T u1 = tile[4*p + 1];
+          T u2 = tile[4*p + 2];
+          T u3 = tile[4*p + 3];
+          T l0 = coeffs[0][p];
+          T l1 = coeffs[1][p];
+          T l2 = coeffs[2][p];
+          T l3 = coeffs[3][p];
+          sum00 += l0*u0; sum01 += l0*u1; sum02 += l0*u2; sum03 += l0*u3;
+          sum10 += l1*u0; sum11 += l1*u1; sum12 += l1*u2; sum13 += l1*u3;
+          sum20 += l2*u0; sum21 += l2*u1; sum22 += l2*u2; sum23 += l2*u3;
+          sum30 += l3*u0; sum31 += l3*u1; sum32 += l3*u2; sum33 += l3*u3;
+        }
+        T* row0 = a + i*n + j;
+        T* row1 = row0 + n;
+        T* row2 = row1 + n;
+        T* row3 = row2 + n;
+        row0[0] -= sum00; row0[1] -= sum01; row0[2] -= sum02; row0[3] -= sum03;
+        row1[0] -= sum10; row1[1] -= sum11; row1[2] -= sum12; row1[3] -= sum13;
+        row2[0] -= sum20; row2[1] -= sum21; row2[2] -= sum22; row2[3] -= sum23;
+        row3[0] -= sum30; row3[1] -= sum31; row3[2] -= sum32; row3[3] -= sum33;
+      }
+    }
+    // rows and columns left over from the tiles
+    for(int row=end; row < n; row++)
+    {
+      int from = row < i ? tiled : first;
+      T* target = a + row*n;
+      for(int p=start; p < end; p++)
+      {
+        const T* rowP = a + p*n;
+        T coeff = target[p];
+        for(int j=from; j < last; j++)
+        {
+          target[j] -= coeff * rowP[j];
+        }
+      }
+    }
+  }
+}
\ No newline at end of file
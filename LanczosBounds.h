@@ -0,0 +1,159 @@
+/*
+  Filename:   LanczosBounds.h
+  Author:     Raymond Hummel
+  Date:       5/29/2014
+  Purpose:    Contains the declaration of the LanczosBounds class
+*/
+
+#ifndef LANCZOSBOUNDS_H
+#define LANCZOSBOUNDS_H
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+
+#include "MatrixBase.h"
+#include "SolverWorkspace.h"
+
+using namespace std;
+
+// fewest Lanczos steps used to estimate the bounds
+const int LANCZOS_STEPS = 40;
+
+
+/*
+Estimates the smallest and largest eigenvalues of D^-1 A for a symmetric
+A with positive diagonal D. Lanczos steps on D^-1/2 A D^-1/2, which has
+the same eigenvalues, build a small tridiagonal matrix whose extreme
+eigenvalues converge to those of A long before the inner ones do, and
+those are found by bisection with Sturm counts. Iterative methods that
+are tuned by the spectrum, such as SOR and Chebyshev, use these bounds
+when no analytic ones are known.
+*/
+template<class T>
+class LanczosBounds
+{
+  public:
+    /*  Description: Constructor, initializes member variables
+        Preconditions: None
+        Postconditions: both bounds are zero until the first estimate
+    */
+    LanczosBounds():smallest(0), largest(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, estimates the extreme
+                     eigenvalues of D^-1 A
+        Preconditions: diagonal holds the diagonal of A, A is symmetric
+                       with a positive diagonal, firstSlot >= 0
+        Postconditions: getSmallest() and getLargest() hold the estimates,
+                        slots firstSlot to firstSlot+3 of workspace are
+                        overwritten
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& diagonal,
+                    SolverWorkspace<T>& workspace, int firstSlot)
+    {
+      int n = diagonal.getSize();
+      // a mesh with N divisions needs about N steps to resolve its
+      // smoothest mode
+      int steps = max(LANCZOS_STEPS, int(sqrt(T(n))));
+      if(steps > n) steps = n;
+      Vector<T>& previous = workspace(firstSlot, n);
+      Vector<T>& q = workspace(firstSlot+1, n);
+      Vector<T>& w = workspace(firstSlot+2, n);
+      Vector<T>& scaled = workspace(firstSlot+3, n);
+      alpha.clear();
+      beta.clear();
+      // the smoothest mode of a mesh is close to a constant vector
+      q = 1 / sqrt(T(n));
+      previous = 0;
+      T length = 0;
+      for(int k=0; k < steps; k++)
+      {
+        for(int i=0; i < n; i++)
+        {
+          previous[i] = previous[i] * length;
+          scaled[i] = q[i] / sqrt(diagonal[i]);
+        }
+        A.multiply(scaled, w);
+        for(int i=0; i < n; i++)
+        {
+          w[i] = w[i] / sqrt(diagonal[i]) - previous[i];
+        }
+        alpha.push_back(q * w);
+        w -= q * alpha.back();
+        length = sqrt(w * w);
+        if(length <= T(0.000000000001) * abs(alpha.back())) break;
+        beta.push_back(length);
+        previous.swap(q);
+        q = w * (1/length);
+      }
+      smallest = tridiagonalEigenvalue(alpha, beta, 0);
+      largest = tridiagonalEigenvalue(alpha, beta, alpha.size()-1);
+    }
+    
+    
+    /*  Description: Getter for smallest
+        Preconditions: None
+        Postconditions: returns the estimate of the smallest eigenvalue
+    */
+    T getSmallest() const { return smallest; }
+    
+    
+    /*  Description: Getter for largest
+        Preconditions: None
+        Postconditions: returns the estimate of the largest eigenvalue
+    */
+    T getLargest() const { return largest; }
+  
+  
+  private:
+    T smallest;
+    T largest;
+    // diagonal and off diagonal of the Lanczos tridiagonal matrix
+    vector<T> alpha;
+    vector<T> beta;
+    
+    
+    /*  Description: Tridiagonal Eigenvalue, bisection with Sturm counts
+        Preconditions: beta has one element fewer than alpha, or as many
+                       when the last one is unused, 0 <= index <
+                       alpha.size()
+        Postconditions: returns eigenvalue number index, counted from the
+                        smallest, of the symmetric tridiagonal matrix with
+                        diagonal alpha and off diagonal beta
+    */
+    static T tridiagonalEigenvalue(const vector<T>& alpha, const vector<T>& beta, int index)
+    {
+      int m = alpha.size();
+      // Gershgorin bounds hold every eigenvalue
+      T low = alpha[0], high = alpha[0];
+      for(int k=0; k < m; k++)
+      {
+        T radius = (k > 0 ? abs(beta[k-1]) : 0) + (k < m-1 ? abs(beta[k]) : 0);
+        low = min(low, alpha[k] - radius);
+        high = max(high, alpha[k] + radius);
+      }
+      for(int iteration=0; iteration < 100 && high - low > T(0.000000000001)*(abs(low) + abs(high)); iteration++)
+      {
+        T middle = (low + high) / 2;
+        // the pivots of T - middle*I that are negative count the
+        // eigenvalues below middle
+        int below = 0;
+        T pivot = 1;
+        for(int k=0; k < m; k++)
+        {
+          T coupling = k > 0 ? beta[k-1]*beta[k-1] : 0;
+          pivot = alpha[k] - middle - (k > 0 ? coupling/pivot : 0);
+          if(pivot == T(0)) pivot = T(0.000000000001) * (abs(low) + abs(high));
+          if(pivot < 0) below++;
+        }
+        if(below > index) high = middle;
+        else low = middle;
+      }
+      return (low + high) / 2;
+    }
+
+};
+
+#endif
\ No newline at end of file
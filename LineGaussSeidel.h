@@ -0,0 +1,183 @@
+/*
+  Filename:   LineGaussSeidel.h
+  Author:     Raymond Hummel
+  Date:       5/27/2014
+  Purpose:    Contains the declaration of the LineGaussSeidel class
+*/
+
+#ifndef LINEGAUSSSEIDEL_H
+#define LINEGAUSSSEIDEL_H
+
+#include <vector>
+#include <cstdlib>
+
+#include "StencilOperator.h"
+#include "Vector.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+
+/*
+Gauss-Seidel by whole mesh lines for the 5-point stencil. The points of
+one horizontal line are coupled to each other by a tridiagonal block with
+diagonal on the diagonal and offDiagonal beside it, and to the lines above
+and below only through the point straight across. Each line is solved
+exactly with the Thomas algorithm while its neighbour lines are held
+fixed. The block is the same for every line, so its elimination factors
+are computed once per solve. Lines are taken in zebra order, all even
+lines and then all odd lines, so the lines of one colour only read lines
+of the other colour and are split across a ThreadPool. Every line is read
+and written from left to right.
+*/
+template<class T>
+class LineGaussSeidel
+{
+  public:
+    /*  Description: Constructor, starts the thread pool
+        Preconditions: None
+        Postconditions: sweeps run on numThreads threads, numThreads < 1
+                        uses one thread per hardware core
+    */
+    LineGaussSeidel(int numThreads = 0)
+      :pool(numThreads), changes(pool.getNumThreads()), sweeps(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is diagonally dominant
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const StencilOperator<T>& A, const Vector<T>& b)
+    {
+      Vector<T> x;
+      operator()(A, b, x);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b starting
+                     from zero
+        Preconditions: A is diagonally dominant
+        Postconditions: x holds the approximate solution of Ax=b, sweeps
+                        stop once a sweep changes x by less than 0.0000001
+                        throws SizeError if b does not match A
+    */
+    void operator()(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x)
+    {
+      if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "LineGaussSeidel");
+      x.setSize(b.getSize());
+      x = 0;
+      
+      const int m = A.getN() - 1;
+      const T offDiagonal = A.getOffDiagonal();
+      factorLine(m, A.getDiagonal(), offDiagonal);
+      T* u = x.data();
+      const T* f = b.data();
+      const int numBlocks = pool.getNumThreads() < m ? pool.getNumThreads() : m;
+      scratch.resize(numBlocks * m);
+      int colour = 0;
+      
+      // block k solves the lines of the current colour among
+      // [k*m/numBlocks, (k+1)*m/numBlocks) and adds how far their points
+      // moved to changes[k]
+      function<void(int)> sweepBlock = [&](int k)
+      {
+        T change = 0;
+        T* g = &scratch[k*m];
+        int first = k*m/numBlocks;
+        if(first%2 != colour) first++;
+        for(int y=first; y < (k+1)*m/numBlocks; y+=2)
+        {
+          T* line = u + y*m;
+          const T* above = y > 0 ? line - m : NULL;
+          const T* below = y < m-1 ? line + m : NULL;
+          // forward elimination, the right side moves the neighbour lines
+          // over to b
+          T previous = 0;
+          for(int i=0; i < m; i++)
+          {
+            T right = f[y*m + i];
+            if(above) right -= offDiagonal * above[i];
+            if(below) right -= offDiagonal * below[i];
+            previous = (right - offDiagonal*previous) * inversePivots[i];
+            g[i] = previous;
+          }
+          // back substitution straight into the line
+          T next = 0;
+          for(int i=m-1; i >= 0; i--)
+          {
+            next = g[i] - uppers[i]*next;
+            change += abs(next - line[i]);
+            line[i] = next;
+          }
+        }
+        changes[k] += change;
+      };
+      
+      T change = 1;
+      sweeps = 0;
+      while(change > 0.0000001)
+      {
+        for(int k=0; k < numBlocks; k++) changes[k] = 0;
+        for(colour=0; colour < 2; colour++)
+        {
+          pool.run(numBlocks, sweepBlock);
+        }
+        change = 0;
+        for(int k=0; k < numBlocks; k++) change += changes[k];
+        sweeps++;
+      }
+    }
+    
+    
+    /*  Description: Getter for sweeps
+        Preconditions: None
+        Postconditions: returns the number of sweeps the last solve took
+    */
+    int getSweeps() const { return sweeps; }
+    
+    
+    /*  Description: Getter for the number of threads
+        Preconditions: None
+        Postconditions: returns the threads a sweep is split across
+    */
+    int getNumThreads() const { return pool.getNumThreads(); }
+  
+  
+  private:
+    ThreadPool pool;
+    // change of each block during the current sweep, kept apart so the
+    // blocks never write to the same element
+    vector<T> changes;
+    int sweeps;
+    // elimination of the line block, 1/pivot and the scaled upper
+    // neighbour of every point
+    vector<T> inversePivots;
+    vector<T> uppers;
+    // forward elimination results, one line for each block
+    vector<T> scratch;
+    
+    
+    /*  Description: Factor Line, eliminates the tridiagonal line block
+        Preconditions: m > 0, the block is diagonally dominant
+        Postconditions: inversePivots and uppers hold the Thomas factors
+                        of the m point block with diag and off
+    */
+    void factorLine(int m, const T& diag, const T& off)
+    {
+      inversePivots.resize(m);
+      uppers.resize(m);
+      T upper = 0;
+      for(int i=0; i < m; i++)
+      {
+        T pivot = diag - off*upper;
+        inversePivots[i] = 1 / pivot;
+        upper = off / pivot;
+        uppers[i] = upper;
+      }
+    }
+
+};
+
+#endif
\ No newline at end of file
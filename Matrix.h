@@ -21,6 +21,7 @@ copy
 #define MATRIX_H
 
 #include "MatrixBase.h"
+#include "AlignedBuffer.h"
 
 
 template<class T>
@@ -37,7 +38,7 @@ class Matrix: public virtual MatrixBase<T>
     /*  Description: Pre-Sized Constructor, creates Matrix of size n by n
         Preconditions: n must be a positive, non-zero integer
                        T must have a defined default constructor
-        Postconditions: head points to an array of Vectors of size n,
+        Postconditions: head points to a buffer of n*n elements,
                         numRows = n, numCols = n, throws a SizeError 
                         exception if n < 0
     */
@@ -47,7 +48,7 @@ class Matrix: public virtual MatrixBase<T>
     /*  Description: Pre-Sized Constructor, creates Matrix of size rows by cols
         Preconditions: rows, cols must be positive, non-zero integers
                        T must have a defined default constructor
-        Postconditions: head points to an array of Vectors of size rows,
+        Postconditions: head points to a buffer of rows*cols elements,
                         numRows = rows, numCols = cols, throws a SizeError 
                         exception if rows or cols < 0
     */
@@ -61,6 +62,15 @@ class Matrix: public virtual MatrixBase<T>
     Matrix(const Matrix<T>& original);
     
     
+    /*  Description: Move Constructor, takes ownership of the elements 
+                     of the parameter instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of original,
+                        original is empty
+    */
+    Matrix(Matrix<T>&& original) noexcept;
+    
+    
     /*  Description: Base Constructor, makes a deep copy of the parameter
         Preconditions: T must have a defined copy assignment operator
         Postconditions: calling object is a deep copy of original
@@ -73,7 +83,7 @@ class Matrix: public virtual MatrixBase<T>
         Postconditions: all dynamic memory associated with the calling 
                         object is freed
     */
-    ~Matrix() { delete [] head; }
+    ~Matrix() { alignedDelete(head, numRows*numCols); }
     
     
     /*  Description: Copy Assignment Operator, supports operator chaining 
@@ -86,6 +96,16 @@ class Matrix: public virtual MatrixBase<T>
     Matrix<T>& operator=(const Matrix<T>& rhs);
     
     
+    /*  Description: Move Assignment Operator, takes ownership of the
+                     elements of rhs instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of rhs, the 
+                        previous elements are freed, rhs is empty
+                        returns a reference to the calling object
+    */
+    Matrix<T>& operator=(Matrix<T>&& rhs) noexcept;
+    
+    
     /*  Description: MatrixBase Assignment Operator, supports operator chaining 
                      and self-assignment
         Preconditions: T must have a defined copy assignment operator
@@ -101,7 +121,8 @@ class Matrix: public virtual MatrixBase<T>
         Preconditions: i is a positive integer between 0 and numRows-1
                        calling object is not const
         Postconditions: returns a reference to the ith vector of the Matrix
-                        throws a RangeError if i < 0 or i >= numRows
+                        throws a RangeError if i < 0 or i >= numRows and
+                        BOUNDS_CHECK is on
     */
     virtual T& operator()(int row, int col);
     
@@ -110,11 +131,30 @@ class Matrix: public virtual MatrixBase<T>
                      access to elements of the matrix
         Preconditions: i is a positive integer between 0 and numRows-1
         Postconditions: returns a const reference to the ith vector of the Matrix
-                        throws a RangeError if i < 0 or i >= numRows
+                        throws a RangeError if i < 0 or i >= numRows and
+                        BOUNDS_CHECK is on
     */
     virtual const T& operator()(int row, int col) const;
     
     
+    /*  Description: Raw Access, provides the element array for kernels
+                     that loop over it directly
+        Preconditions: None
+        Postconditions: returns a pointer to the numRows*numCols elements
+                        stored by row, element (i,j) is at [i*numCols + j],
+                        it is invalidated by anything that changes the size
+    */
+    T* data() { return head; }
+    
+    
+    /*  Description: const Raw Access, provides read-only access to the
+                     element array
+        Preconditions: None
+        Postconditions: returns a pointer to the elements stored by row
+    */
+    const T* data() const { return head; }
+    
+    
     /*  Description: Matrix Addition, adds matrices
         Preconditions: T must have a defined addition operator
                        T must have a defined copy assignment operator
@@ -216,6 +256,15 @@ class Matrix: public virtual MatrixBase<T>
     virtual bool isDiagonallyDominant() const;
     
     
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector straight from the contiguous storage
+        Preconditions: None
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
     /*  Description: Transpose
         Preconditions: None
         Postconditions: returns the transpose of the calling object
@@ -225,8 +274,8 @@ class Matrix: public virtual MatrixBase<T>
     
     /*  Description: Row Swap, swaps the positions of two rows
         Preconditions: None
-        Postconditions: vector originally found at rowIndex1 is now found
-                        at rowIndex2 and vice versa
+        Postconditions: elements originally found in rowIndex1 are now found
+                        in rowIndex2 and vice versa
     */
     void swapRows(int rowIndex1, int rowIndex2);
     
@@ -239,9 +288,19 @@ class Matrix: public virtual MatrixBase<T>
     */
     void setSize(int rows, int cols);
     
+    
+    /*  Description: Swap, exchanges the elements of two matrices without
+                     copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of other and
+                        vice versa
+    */
+    void swap(Matrix<T>& other) noexcept;
+  
   private:
     int numRows, numCols;
-    Vector<T>* head;
+    // one cache-line aligned buffer, row-major so (i,j) is head[i*numCols+j]
+    T* head;
     
     
     /*  Description: copy function, creates deep copy of elements in a
@@ -252,5 +311,14 @@ class Matrix: public virtual MatrixBase<T>
     
 };
 
+
+/*  Description: Swap, exchanges the elements of two matrices without
+                 copying them
+    Preconditions: None
+    Postconditions: a holds the elements of b and vice versa
+*/
+template<class T>
+void swap(Matrix<T>& a, Matrix<T>& b) noexcept { a.swap(b); }
+
 #include "Matrix.hpp"
 #endif
\ No newline at end of file
@@ -26,6 +26,15 @@ Matrix<T>::Matrix(const Matrix<T>& original):numRows(0), numCols(0), head(NULL)
   copy(original);
 }
 
+template<class T>
+Matrix<T>::Matrix(Matrix<T>&& original) noexcept
+  :numRows(original.numRows), numCols(original.numCols), head(original.head)
+{
+  original.numRows = 0;
+  original.numCols = 0;
+  original.head = NULL;
+}
+
 /*
 template<class T>
 Matrix<T>::Matrix(const MatrixBase<T>& original):numRows(0), numCols(0), head(NULL)
@@ -45,6 +54,23 @@ Matrix<T>& Matrix<T>::operator=(const Matrix<T>& rhs)
 }
 
 
+template<class T>
+Matrix<T>& Matrix<T>::operator=(Matrix<T>&& rhs) noexcept
+{
+  if(this != &rhs)
+  {
+    alignedDelete(head, numRows*numCols);
+    numRows = rhs.numRows;
+    numCols = rhs.numCols;
+    head = rhs.head;
+    rhs.numRows = 0;
+    rhs.numCols = 0;
+    rhs.head = NULL;
+  }
+  return *this;
+}
+
+
 template<class T>
 MatrixBase<T>& Matrix<T>::operator=(const MatrixBase<T>& rhs)
 {
@@ -69,18 +95,22 @@ MatrixBase<T>& Matrix<T>::operator=(const MatrixBase<T>& rhs)
 template<class T>
 T& Matrix<T>::operator()(int row, int col)
 {
+#if BOUNDS_CHECK
   if(row < 0 || row >= getNumRows()) throw RangeError(row,"operator(): row");
   if(col < 0 || col >= getNumCols()) throw RangeError(col,"operator(): col");
-  return head[row][col];
+#endif
+  return head[row*numCols + col];
 }
 
 
 template<class T>
 const T& Matrix<T>::operator()(int row, int col) const
 {
+#if BOUNDS_CHECK
   if(row < 0 || row >= getNumRows()) throw RangeError(row,"operator(): const row");
   if(col < 0 || col >= getNumCols()) throw RangeError(col,"operator(): const col");
-  return head[row][col];
+#endif
+  return head[row*numCols + col];
 }
 
 
@@ -139,16 +169,17 @@ template<class T>
 MatrixBase<T>& Matrix<T>::operator*=(const MatrixBase<T>& rhs)
 {
   if( getNumCols() != rhs.getNumRows() ) throw SizeError(getNumCols(), "operator*= matrix");
-  MatrixBase<T>* retVal = new Matrix<T>(getNumRows(), rhs.getNumCols());
-  for(int i=0; i < getNumRows(); i++)
+  Matrix<T> retVal(getNumRows(), rhs.getNumCols());
+  for(int j=0; j < rhs.getNumCols(); j++)
   {
-    for(int j=0; j < rhs.getNumCols(); j++)
+    Vector<T> column = rhs.getColumn(j);
+    for(int i=0; i < getNumRows(); i++)
     {
-      retVal->operator()(i,j) = getRow(i) * rhs.getColumn(j);
+      retVal(i,j) = rowProduct(i, column);
     }
   }
-  *this = *retVal;
-  delete retVal;
+  // the product replaces the calling object without another copy
+  swap(retVal);
   return *this;
 }
 
@@ -156,11 +187,26 @@ MatrixBase<T>& Matrix<T>::operator*=(const MatrixBase<T>& rhs)
 template<class T>
 Vector<T> Matrix<T>::operator*(const Vector<T>& rhs) const
 {
-  if( getNumRows() != rhs.getSize() ) throw SizeError(rhs.getSize(), "operator*= vector");
+  if( getNumCols() != rhs.getSize() ) throw SizeError(rhs.getSize(), "operator*= vector");
   Vector<T> retVal(getNumRows());
   for(int i=0; i < getNumRows(); i++)
   {
-    retVal[i] = getRow(i) * rhs;
+    retVal[i] = rowProduct(i, rhs);
+  }
+  return retVal;
+}
+
+
+template<class T>
+T Matrix<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if( numCols != x.getSize() ) throw SizeError(x.getSize(), "rowProduct");
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "rowProduct");
+  const T* row = head + rowIndex*numCols;
+  T retVal = 0;
+  for(int j=0; j < numCols; j++)
+  {
+    retVal += row[j] * x[j];
   }
   return retVal;
 }
@@ -183,17 +229,17 @@ template<class T>
 void Matrix<T>::addColumn(const Vector<T>& newCol)
 {
   if(newCol.getSize() != numRows) throw SizeError(newCol.getSize());
-  Vector<T> temp(numCols + 1);
+  T* temp = alignedNew<T>(numRows*(numCols + 1));
   for(int i=0; i < numRows; i++)
   {
     for(int j=0; j < numCols; j++)
     {
-      temp[j] = head[i][j];
+      temp[i*(numCols + 1) + j] = head[i*numCols + j];
     }
-    temp[numCols] = newCol[i];
-    head[i].setSize(numCols + 1);
-    head[i] = temp;
+    temp[i*(numCols + 1) + numCols] = newCol[i];
   }
+  alignedDelete(head, numRows*numCols);
+  head = temp;
   numCols++;
 }
 
@@ -201,11 +247,12 @@ void Matrix<T>::addColumn(const Vector<T>& newCol)
 template<class T>
 Vector<T> Matrix<T>::getRow(int rowIndex) const
 {
-  if(rowIndex < 0 || rowIndex >= getNumCols()) { throw RangeError(rowIndex,"getRow"); }
+  if(rowIndex < 0 || rowIndex >= getNumRows()) { throw RangeError(rowIndex,"getRow"); }
   Vector<T> retVal( getNumCols() );
+  const T* row = head + rowIndex*numCols;
   for(int i=0; i < getNumCols(); i++)
   {
-    retVal[i] = operator()(rowIndex,i);
+    retVal[i] = row[i];
   }
   return retVal;
 }
@@ -236,7 +283,10 @@ Matrix<T> Matrix<T>::transpose() const
   Matrix<T> retVal(getNumCols(), getNumRows());
   for(int i=0; i < getNumRows(); i++)
   {
-    retVal.head[i] = getColumn(i);
+    for(int j=0; j < getNumCols(); j++)
+    {
+      retVal.head[j*numRows + i] = head[i*numCols + j];
+    }
   }
   return retVal;
 }
@@ -245,9 +295,16 @@ Matrix<T> Matrix<T>::transpose() const
 template<class T>
 void Matrix<T>::swapRows(int rowIndex1, int rowIndex2)
 {
-  Vector<T> temp(head[rowIndex1]);
-  head[rowIndex1] = head[rowIndex2];
-  head[rowIndex2] = temp;
+  if(rowIndex1 < 0 || rowIndex1 >= numRows) throw RangeError(rowIndex1, "swapRows");
+  if(rowIndex2 < 0 || rowIndex2 >= numRows) throw RangeError(rowIndex2, "swapRows");
+  T* row1 = head + rowIndex1*numCols;
+  T* row2 = head + rowIndex2*numCols;
+  for(int j=0; j < numCols; j++)
+  {
+    T temp = row1[j];
+    row1[j] = row2[j];
+    row2[j] = temp;
+  }
 }
 
 
@@ -258,18 +315,29 @@ void Matrix<T>::setSize(int rows, int cols)
   {
     if(rows < 0) throw SizeError(rows, "setSize: row");
     if(cols < 0) throw SizeError(cols, "setSize: col");
-    delete [] head;
+    alignedDelete(head, numRows*numCols);
     numRows = rows;
     numCols = cols;
-    head = new Vector<T>[numRows];
-    for(int i=0; i<numRows; i++)
-    {
-      head[i].setSize(numCols);
-    }
+    head = alignedNew<T>(numRows*numCols);
   }
 }
 
 
+template<class T>
+void Matrix<T>::swap(Matrix<T>& other) noexcept
+{
+  int tempRows = numRows;
+  int tempCols = numCols;
+  T* tempHead = head;
+  numRows = other.numRows;
+  numCols = other.numCols;
+  head = other.head;
+  other.numRows = tempRows;
+  other.numCols = tempCols;
+  other.head = tempHead;
+}
+
+
 template<class T>
 void Matrix<T>::copy(const MatrixBase<T>& a)
 {
@@ -278,7 +346,7 @@ void Matrix<T>::copy(const MatrixBase<T>& a)
   {
     for(int j=0; j < a.getNumCols(); j++)
     {
-      head[i][j] = a(i,j);
+      head[i*numCols + j] = a(i,j);
     }
   }
 }
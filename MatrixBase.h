@@ -11,6 +11,7 @@
 #include <iostream>
 #include <cstdlib>
 #include <cmath>
+#include <vector>
 
 #include "Vector.h"
 #include "Error.h"
@@ -154,6 +155,47 @@ class MatrixBase
     virtual bool isDiagonallyDominant() const = 0;
     
     
+    /*  Description: Determines if matrix is symmetric, derived classes
+                     with structural knowledge should override this check
+        Preconditions: None
+        Postconditions: returns true if Aij == Aji for all i,j, else false
+    */
+    virtual bool symmetric() const;
+    
+    
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector without building the row, derived classes
+                     should override this to only visit stored elements
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
+    /*  Description: Multiply Into, multiplies the matrix by a vector and
+                     stores the product in an existing vector, so repeated
+                     products do not allocate once result has the right size
+        Preconditions: result is not the same object as x
+        Postconditions: result = A*x with size = numRows
+                        throws SizeError if numCols != x.size
+    */
+    virtual void multiply(const Vector<T>& x, Vector<T>& result) const;
+    
+    
+    /*  Description: Row Nonzeros, lists the nonzero elements of one row,
+                     derived classes should override this to only visit
+                     stored elements
+        Preconditions: 0 <= rowIndex < numRows
+        Postconditions: columns holds the column of every nonzero in
+                        increasing order and values holds the matching
+                        elements, both are cleared first
+                        throws RangeError if rowIndex is out of range
+    */
+    virtual void getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const;
+    
+    
     /*  Description: Extraction operator
         Preconditions: None
         Postconditions: elements of matrix are streamed to output, 
@@ -181,6 +223,66 @@ class MatrixBase
 };
 
 
+template<class T>
+bool MatrixBase<T>::symmetric() const
+{
+  if(getNumRows() != getNumCols()) return false;
+  
+  for(int i=0; i < getNumRows(); i++)
+  {
+    for(int j=0; j < i; j++)
+    {
+      if(operator()(i,j) != operator()(j,i)) return false;
+    }
+  }
+  return true;
+}
+
+
+template<class T>
+T MatrixBase<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if(getNumCols() != x.getSize()) throw SizeError(x.getSize(), "rowProduct");
+  T retVal = 0;
+  for(int j=0; j < getNumCols(); j++)
+  {
+    retVal += operator()(rowIndex,j) * x[j];
+  }
+  return retVal;
+}
+
+
+template<class T>
+void MatrixBase<T>::multiply(const Vector<T>& x, Vector<T>& result) const
+{
+  if(getNumCols() != x.getSize()) throw SizeError(x.getSize(), "multiply");
+  if(&x == &result) throw "multiply cannot store the product in its operand";
+  result.setSize(getNumRows());
+  for(int i=0; i < getNumRows(); i++)
+  {
+    result[i] = rowProduct(i, x);
+  }
+}
+
+
+template<class T>
+void MatrixBase<T>::getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const
+{
+  if(rowIndex < 0 || rowIndex >= getNumRows()) throw RangeError(rowIndex, "getRowNonzeros");
+  columns.clear();
+  values.clear();
+  for(int j=0; j < getNumCols(); j++)
+  {
+    const T& element = operator()(rowIndex,j);
+    if(element != T(0))
+    {
+      columns.push_back(j);
+      values.push_back(element);
+    }
+  }
+}
+
+
 template<class T>
 ostream& operator<<( ostream& output, const MatrixBase<T>& matrix)
 {
@@ -9,41 +9,75 @@
 #define MATRIXGENERATOR_H
 
 #include <exception>
+#include <vector>
 #include "SymmetricMatrix.h"
+#include "SparseMatrix.h"
+#include "BandedSymmetricMatrix.h"
 
 class MatrixGenerator
 {
   public:
     /*  Description: Constructor, initializes member variables
         Preconditions: N must be a positive, non-zero integer
-        Postconditions: theMatrix is the correct matrix for a Direchlet 
-                        problem with N mesh divisions
+        Postconditions: the generator describes a Direchlet problem 
+                        with N mesh divisions
     */
-    MatrixGenerator(int N){ buildMatrix(N); }
+    MatrixGenerator(int N):N(N){}
     
     /*  Description: Getter
         Preconditions: None
-        Postconditions: returns theMatrix
+        Postconditions: returns the correct matrix for a Direchlet 
+                        problem with N mesh divisions
+    */
+    SymmetricMatrix<double> getMatrix()
+    {
+      SymmetricMatrix<double> theMatrix;
+      buildMatrix(theMatrix);
+      return theMatrix;
+    }
+    
+    /*  Description: Sparse Getter, only the nonzeros are ever stored
+        Preconditions: None
+        Postconditions: returns the correct matrix for a Direchlet 
+                        problem with N mesh divisions in CSR form
+    */
+    SparseMatrix<double> getSparseMatrix()
+    {
+      SparseMatrix<double> theMatrix;
+      buildSparseMatrix(theMatrix);
+      return theMatrix;
+    }
+    
+    /*  Description: Banded Getter, only the upper band of width N-1 
+                     is stored
+        Preconditions: None
+        Postconditions: returns the correct matrix for a Direchlet 
+                        problem with N mesh divisions in banded form
     */
-    SymmetricMatrix<double> getMatrix(){ return theMatrix; }
+    BandedSymmetricMatrix<double> getBandedMatrix()
+    {
+      BandedSymmetricMatrix<double> theMatrix;
+      buildBandedMatrix(theMatrix);
+      return theMatrix;
+    }
     
     /*  Description: Setter
         Preconditions: N must be a positive, non-zero integer
-        Postconditions: theMatrix is the correct matrix for a Direchlet 
-                        problem with N mesh divisions
+        Postconditions: the generator describes a Direchlet problem 
+                        with N mesh divisions
     */
-    void set(int N){ buildMatrix(N); }
+    void set(int N){ this->N = N; }
     
     
   private:
-    SymmetricMatrix<double> theMatrix;
+    int N;
     
-    /*  Description: Container for common behavior between constructor and setter
+    /*  Description: Fills a SymmetricMatrix, every entry is written
         Preconditions: N must be a positive, non-zero integer
         Postconditions: theMatrix is the correct matrix for a Direchlet 
                         problem with N mesh divisions
     */
-    void buildMatrix(int N)
+    void buildMatrix(SymmetricMatrix<double>& theMatrix)
     {
       int size = (N-1)*(N-1);
       double h = 1.0/N;
@@ -83,6 +117,71 @@ class MatrixGenerator
       }
     }
     
+    /*  Description: Fills a BandedSymmetricMatrix, only the band is written
+        Preconditions: N must be a positive, non-zero integer
+        Postconditions: theMatrix is the correct matrix for a Direchlet 
+                        problem with N mesh divisions
+    */
+    void buildBandedMatrix(BandedSymmetricMatrix<double>& theMatrix)
+    {
+      int lineSize = N-1;
+      int size = lineSize*lineSize;
+      int bandwidth = (size > 1) ? lineSize : 0;
+      double h = 1.0/N;
+      theMatrix.setSize(size, bandwidth);
+      
+      for(int row=0; row < size; row++)
+      {
+        int pos = row%lineSize;
+        for(int col=row; col < size && col <= row+bandwidth; col++)
+        {
+          //up
+          if(col == row+lineSize) theMatrix(row,col) = -h;
+          //right
+          else if(col == row+1 && pos != lineSize-1) theMatrix(row,col) = -h;
+          //itself
+          else if(row == col) theMatrix(row,row) = 1;
+          //every other entry of the band
+          else theMatrix(row,col) = 0;
+        }
+      }
+    }
+    
+    /*  Description: Fills a SparseMatrix, only the nonzeros are written
+        Preconditions: N must be a positive, non-zero integer
+        Postconditions: theMatrix is the correct matrix for a Direchlet 
+                        problem with N mesh divisions
+    */
+    void buildSparseMatrix(SparseMatrix<double>& theMatrix)
+    {
+      int lineSize = N-1;
+      int size = lineSize*lineSize;
+      double h = 1.0/N;
+      vector<int> rowStart(size+1, 0);
+      vector<int> colIndex;
+      vector<double> values;
+      colIndex.reserve(5*size);
+      values.reserve(5*size);
+      
+      // columns are visited in increasing order so every row stays sorted
+      for(int row=0; row < size; row++)
+      {
+        int pos = row%lineSize;
+        //down
+        if(row-lineSize >= 0) { colIndex.push_back(row-lineSize); values.push_back(-h); }
+        //left
+        if(pos != 0) { colIndex.push_back(row-1); values.push_back(-h); }
+        //itself
+        colIndex.push_back(row); values.push_back(1);
+        //right
+        if(pos != lineSize-1) { colIndex.push_back(row+1); values.push_back(-h); }
+        //up
+        if(row+lineSize < size) { colIndex.push_back(row+lineSize); values.push_back(-h); }
+        rowStart[row+1] = values.size();
+      }
+      theMatrix = SparseMatrix<double>(size, size, rowStart, colIndex, values);
+    }
+
 };
 
 #endif
\ No newline at end of file
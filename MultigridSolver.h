@@ -0,0 +1,189 @@
+/*
+  Filename:   MultigridSolver.h
+  Author:     Raymond Hummel
+  Date:       5/20/2014
+  Purpose:    Contains the declaration of the MultigridSolver class
+*/
+
+#ifndef MULTIGRIDSOLVER_H
+#define MULTIGRIDSOLVER_H
+
+#include <vector>
+
+#include "StencilOperator.h"
+#include "Vector.h"
+#include "Norm.h"
+
+using namespace std;
+
+
+/*
+Geometric multigrid for the 5-point stencil on the unit square. The mesh
+with N divisions is coarsened to N/2, N/4, ... for as long as N stays even,
+every coarse point sits on a fine point so the grids are nested. Each
+cycle smooths with Gauss-Seidel, restricts the residual with full
+weighting, corrects from the coarse grid and interpolates the correction
+back bilinearly. Full multigrid runs the same cycles from the coarsest
+grid up, starting each grid from the interpolated solution of the one
+below.
+
+A stencil with diagonal d and offDiagonal o is (d+4o)I + (-o)L where L is
+the 4,-1 Laplacian stencil. L measures second differences in units of the
+mesh spacing, which doubles on the coarse grid, so the coarse stencil is
+(d+4o)I + (-o/4)L, that is diagonal d+3o and offDiagonal o/4.
+*/
+template<class T>
+class MultigridSolver
+{
+  public:
+    // number of coarse grid corrections per level, V_CYCLE does one
+    // and W_CYCLE does two
+    enum Cycle { V_CYCLE = 1, W_CYCLE = 2 };
+    
+    
+    /*  Description: Constructor, selects the cycle and the smoothing
+        Preconditions: preSmooth, postSmooth >= 0
+        Postconditions: every cycle does preSmooth Gauss-Seidel sweeps
+                        before and postSmooth sweeps after each coarse
+                        grid correction
+    */
+    MultigridSolver(Cycle cycle = V_CYCLE, int preSmooth = 2, int postSmooth = 2)
+      :cycleType(cycle), preSmooth(preSmooth), postSmooth(postSmooth),
+       tolerance(0.0000001), cycles(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is positive definite
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const StencilOperator<T>& A, const Vector<T>& b);
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b reusing the
+                     grid hierarchy of the previous solve when the mesh is
+                     the same
+        Preconditions: A is positive definite
+        Postconditions: x holds the approximate solution of Ax=b, cycles
+                        stop once the residual is tolerance times b
+                        throws SizeError if b does not match A
+    */
+    void operator()(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x);
+    
+    
+    /*  Description: Full Multigrid, solves Ax=b starting on the coarsest
+                     grid, each finer grid starts from the interpolated
+                     solution of the grid below and gets cyclesPerLevel
+                     cycles
+        Preconditions: A is positive definite, cyclesPerLevel > 0
+        Postconditions: x holds the approximate solution of Ax=b with an
+                        algebraic error about the size of the
+                        discretization error rather than the tolerance,
+                        a grid with no coarser grid is solved to the
+                        tolerance instead
+                        throws SizeError if b does not match A
+    */
+    void fullMultigrid(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x, int cyclesPerLevel = 1);
+    
+    
+    /*  Description: Setter for the cycle
+        Preconditions: None
+        Postconditions: later solves use newCycle
+    */
+    void setCycle(Cycle newCycle) { cycleType = newCycle; }
+    
+    
+    /*  Description: Setter for the tolerance
+        Preconditions: newTolerance > 0
+        Postconditions: later solves stop when norm(b-Ax) <=
+                        newTolerance*norm(b)
+    */
+    void setTolerance(const T& newTolerance) { tolerance = newTolerance; }
+    
+    
+    /*  Description: Getter for cycles
+        Preconditions: None
+        Postconditions: returns the number of cycles the last solve took
+    */
+    int getCycles() const { return cycles; }
+    
+    
+    /*  Description: Getter for the number of levels
+        Preconditions: None
+        Postconditions: returns the number of grids in the hierarchy of
+                        the last solve, the finest included
+    */
+    int getNumLevels() const { return operators.size(); }
+  
+  
+  private:
+    Cycle cycleType;
+    int preSmooth, postSmooth;
+    T tolerance;
+    int cycles;
+    // level 0 is the finest grid
+    vector<StencilOperator<T> > operators;
+    vector<Vector<T> > solutions;
+    vector<Vector<T> > rightSides;
+    vector<Vector<T> > residuals;
+    
+    
+    /*  Description: Build Hierarchy, creates the coarse grids for A
+        Preconditions: None
+        Postconditions: operators holds A followed by every coarse stencil,
+                        the vectors of each level are sized, nothing is
+                        rebuilt when A matches the previous hierarchy
+    */
+    void buildHierarchy(const StencilOperator<T>& A);
+    
+    
+    /*  Description: Cycle, improves the solution on one level
+        Preconditions: rightSides[level] holds the level's right side
+        Postconditions: solutions[level] is improved by one V or W cycle
+    */
+    void cycle(int level);
+    
+    
+    /*  Description: Smooth, runs Gauss-Seidel sweeps on one level
+        Preconditions: None
+        Postconditions: solutions[level] has had sweeps sweeps applied
+    */
+    void smooth(int level, int sweeps);
+    
+    
+    /*  Description: Compute Residual, finds b-Ax on one level
+        Preconditions: None
+        Postconditions: residuals[level] = rightSides[level] -
+                        A*solutions[level]
+    */
+    void computeResidual(int level);
+    
+    
+    /*  Description: Restrict Residual, moves the residual of a level to
+                     the next coarser level with full weighting
+        Preconditions: level+1 < getNumLevels(), residuals[level] is set
+        Postconditions: rightSides[level+1] holds the weighted residual
+    */
+    void restrictResidual(int level);
+    
+    
+    /*  Description: Restrict Right Sides, moves the right side of every
+                     level to the next coarser level with full weighting
+        Preconditions: rightSides[0] is set
+        Postconditions: rightSides[level] holds the weighted right side of
+                        the finest grid on each coarse level
+    */
+    void restrictRightSides();
+    
+    
+    /*  Description: Prolong Correction, interpolates the coarse solution
+                     bilinearly and adds it to the fine solution
+        Preconditions: level+1 < getNumLevels()
+        Postconditions: solutions[level] is corrected
+    */
+    void prolongCorrection(int level);
+
+};
+
+#include "MultigridSolver.hpp"
+#endif
\ No newline at end of file
@@ -0,0 +1,256 @@
+/*
+  Filename:   MultigridSolver.hpp
+  Author:     Raymond Hummel
+  Date:       5/20/2014
+  Purpose:    Contains the implementation of the MultigridSolver class
+*/
+
+
+// sweeps used to solve the coarsest grid, it has a single point unless
+// N had an odd factor
+const int COARSEST_SWEEPS = 50;
+// cycles before a solve gives up
+const int MAX_CYCLES = 100;
+
+
+template<class T>
+Vector<T> MultigridSolver<T>::operator()(const StencilOperator<T>& A, const Vector<T>& b)
+{
+  Vector<T> x;
+  operator()(A, b, x);
+  return x;
+}
+
+
+template<class T>
+void MultigridSolver<T>::operator()(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x)
+{
+  if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "MultigridSolver");
+  Norm<T> norm;
+  buildHierarchy(A);
+  rightSides[0] = b;
+  solutions[0] = 0;
+  T target = tolerance * norm(b);
+  
+  cycles = 0;
+  computeResidual(0);
+  while( norm(residuals[0]) > target )
+  {
+    cycle(0);
+    computeResidual(0);
+    cycles++;
+    if(cycles >= MAX_CYCLES)
+    {
+      cout << "MultigridSolver did not converge after " << MAX_CYCLES << " cycles" << endl;
+      break;
+    }
+  }
+  x = solutions[0];
+}
+
+
+template<class T>
+void MultigridSolver<T>::fullMultigrid(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x, int cyclesPerLevel)
+{
+  if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "MultigridSolver fullMultigrid");
+  buildHierarchy(A);
+  int coarsest = getNumLevels()-1;
+  if(coarsest == 0)
+  {
+    // no coarser grid to start from
+    operator()(A, b, x);
+    return;
+  }
+  rightSides[0] = b;
+  restrictRightSides();
+  
+  solutions[coarsest] = 0;
+  cycle(coarsest);
+  for(int level=coarsest-1; level >= 0; level--)
+  {
+    // the interpolated coarse solution is wrong by about the difference
+    // between the two discretizations, a cycle cuts that error well below
+    // the discretization error of the level, more cycles gain nothing
+    solutions[level] = 0;
+    prolongCorrection(level);
+    for(int k=0; k < cyclesPerLevel; k++)
+    {
+      cycle(level);
+    }
+  }
+  cycles = cyclesPerLevel;
+  x = solutions[0];
+}
+
+
+template<class T>
+void MultigridSolver<T>::buildHierarchy(const StencilOperator<T>& A)
+{
+  if( !operators.empty() && operators[0].getN() == A.getN()
+      && operators[0].getDiagonal() == A.getDiagonal()
+      && operators[0].getOffDiagonal() == A.getOffDiagonal() ) return;
+  
+  operators.clear();
+  operators.push_back(A);
+  int N = A.getN();
+  T diagonal = A.getDiagonal();
+  T offDiagonal = A.getOffDiagonal();
+  while(N%2 == 0 && N/2 >= 2)
+  {
+    N = N/2;
+    diagonal = diagonal + 3*offDiagonal;
+    offDiagonal = offDiagonal/4;
+    operators.push_back(StencilOperator<T>(N, diagonal, offDiagonal));
+  }
+  
+  int numLevels = operators.size();
+  solutions.resize(numLevels);
+  rightSides.resize(numLevels);
+  residuals.resize(numLevels);
+  for(int level=0; level < numLevels; level++)
+  {
+    int size = operators[level].getNumRows();
+    solutions[level].setSize(size);
+    rightSides[level].setSize(size);
+    residuals[level].setSize(size);
+  }
+}
+
+
+template<class T>
+void MultigridSolver<T>::cycle(int level)
+{
+  if(level == getNumLevels()-1)
+  {
+    smooth(level, COARSEST_SWEEPS);
+    return;
+  }
+  smooth(level, preSmooth);
+  computeResidual(level);
+  restrictResidual(level);
+  solutions[level+1] = 0;
+  for(int k=0; k < cycleType; k++)
+  {
+    cycle(level+1);
+  }
+  prolongCorrection(level);
+  smooth(level, postSmooth);
+}
+
+
+template<class T>
+void MultigridSolver<T>::smooth(int level, int sweeps)
+{
+  const int m = operators[level].getN() - 1;
+  const T diagonal = operators[level].getDiagonal();
+  const T offDiagonal = operators[level].getOffDiagonal();
+  T* u = solutions[level].data();
+  const T* f = rightSides[level].data();
+  for(int sweep=0; sweep < sweeps; sweep++)
+  {
+    for(int y=0; y < m; y++)
+    {
+      for(int x=0; x < m; x++)
+      {
+        int i = y*m + x;
+        T neighbours = 0;
+        if(y > 0) neighbours += u[i-m];
+        if(x > 0) neighbours += u[i-1];
+        if(x < m-1) neighbours += u[i+1];
+        if(y < m-1) neighbours += u[i+m];
+        u[i] = (f[i] - offDiagonal*neighbours) / diagonal;
+      }
+    }
+  }
+}
+
+
+template<class T>
+void MultigridSolver<T>::computeResidual(int level)
+{
+  const int m = operators[level].getN() - 1;
+  const T diagonal = operators[level].getDiagonal();
+  const T offDiagonal = operators[level].getOffDiagonal();
+  const T* u = solutions[level].data();
+  const T* f = rightSides[level].data();
+  T* r = residuals[level].data();
+  for(int y=0; y < m; y++)
+  {
+    for(int x=0; x < m; x++)
+    {
+      int i = y*m + x;
+      T neighbours = 0;
+      if(y > 0) neighbours += u[i-m];
+      if(x > 0) neighbours += u[i-1];
+      if(x < m-1) neighbours += u[i+1];
+      if(y < m-1) neighbours += u[i+m];
+      r[i] = f[i] - diagonal*u[i] - offDiagonal*neighbours;
+    }
+  }
+}
+
+
+template<class T>
+void MultigridSolver<T>::restrictResidual(int level)
+{
+  const int m = operators[level].getN() - 1;
+  const int coarseM = operators[level+1].getN() - 1;
+  const T* r = residuals[level].data();
+  T* f = rightSides[level+1].data();
+  for(int Y=0; Y < coarseM; Y++)
+  {
+    for(int X=0; X < coarseM; X++)
+    {
+      // the coarse point lies on fine point (2X+1,2Y+1), all eight of
+      // its fine neighbours are inner points
+      int i = (2*Y+1)*m + 2*X+1;
+      T edges = r[i-m] + r[i-1] + r[i+1] + r[i+m];
+      T corners = r[i-m-1] + r[i-m+1] + r[i+m-1] + r[i+m+1];
+      f[Y*coarseM + X] = (4*r[i] + 2*edges + corners) / 16;
+    }
+  }
+}
+
+
+template<class T>
+void MultigridSolver<T>::restrictRightSides()
+{
+  // the restriction reads the residual of a level, so each right side
+  // goes through it before being weighted
+  for(int level=0; level+1 < getNumLevels(); level++)
+  {
+    residuals[level] = rightSides[level];
+    restrictResidual(level);
+  }
+}
+
+
+template<class T>
+void MultigridSolver<T>::prolongCorrection(int level)
+{
+  const int m = operators[level].getN() - 1;
+  const int coarseM = operators[level+1].getN() - 1;
+  const T* e = solutions[level+1].data();
+  T* u = solutions[level].data();
+  // each coarse value is spread over the fine points around it, the fine
+  // points between two coarse points receive half from each
+  for(int Y=0; Y < coarseM; Y++)
+  {
+    for(int X=0; X < coarseM; X++)
+    {
+      int i = (2*Y+1)*m + 2*X+1;
+      T value = e[Y*coarseM + X];
+      T half = value/2;
+      T quarter = value/4;
+      u[i] += value;
+      u[i-m] += half;
+      u[i-1] += half;
+      u[i+1] += half;
+      u[i+m] += half;
+      u[i-m-1] += quarter;
+      u[i-m+1] += quarter;
+      u[i+m-1] += quarter;
+      u[i+m+1] += quarter;
+    }
+  }
+}
\ No newline at end of file
@@ -17,8 +17,15 @@ template <class T>
 class Norm
 {
   public:
-    T operator()(const Vector<T>& vect)
+    /*  Description: Function Evaluation Operator, sums the absolute values
+                     of a vector or vector expression in a single pass
+        Preconditions: T must have an overload for the abs() function
+        Postconditions: returns the 1-norm of vect
+    */
+    template<class E>
+    T operator()(const VectorExpression<T,E>& expression)
     {
+      const E& vect = static_cast<const E&>(expression);
       T norm = 0;
       int size = vect.getSize();
       
@@ -0,0 +1,255 @@
+/*
+  Filename:   OperatorCache.h
+  Author:     Raymond Hummel
+  Date:       5/31/2014
+  Purpose:    Contains the definition and implementation of the
+              OperatorCache class
+*/
+
+#ifndef OPERATORCACHE_H
+#define OPERATORCACHE_H
+
+#include <map>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <utility>
+
+#include "MatrixBase.h"
+#include "CholeskyFactorization.h"
+#include "IncompleteCholesky.h"
+
+using namespace std;
+
+// objects an OperatorCache keeps alive unless it is told otherwise, the
+// operator and factor of the two most recent meshes
+const int RECENT_ENTRIES = 4;
+
+
+/*
+The Direchlet operator of a mesh depends only on N and the storage it is
+kept in, and its factors only on the operator, so every solver for the
+same mesh can share one copy of each. An OperatorCache hands them out as
+shared pointers to const objects, keyed by N and a storage number chosen
+by the caller, and builds each one when it is not cached.
+
+A solver is usually constructed, solved and destroyed, so the cache holds
+the most recently used objects itself, getNumRecent() of them across all
+three kinds, and a new solver for one of those meshes finds them ready.
+Beyond that bound the cache only keeps weak pointers, so an older entry
+is freed once the last solver using it lets go, and the dense operators
+and factors of meshes that are no longer solved do not pile up.
+
+The cache is guarded by a mutex, but builds run outside of it so one
+thread assembling a large mesh does not hold up lookups for the others.
+When two threads build the same entry at once the first one stored is
+kept.
+*/
+class OperatorCache
+{
+  public:
+    // key of an entry, the mesh divisions and the caller's storage number
+    typedef pair<int,int> Key;
+    
+    
+    /*  Description: Shared, returns the cache every solver uses
+        Preconditions: None
+        Postconditions: returns the same cache on every call
+    */
+    static OperatorCache& shared()
+    {
+      static OperatorCache cache;
+      return cache;
+    }
+    
+    
+    /*  Description: Constructor, creates an empty cache
+        Preconditions: numRecent >= 0
+        Postconditions: the cache holds no entries, and will keep the
+                        numRecent most recently used objects alive
+    */
+    OperatorCache(int numRecent = RECENT_ENTRIES) :numRecent(numRecent) {}
+    
+    
+    /*  Description: Get Operator, looks up the operator of a mesh
+        Preconditions: build returns a new operator for N in storage
+        Postconditions: returns the cached operator, calling build and
+                        storing the result the first time
+    */
+    shared_ptr<const MatrixBase<double> > getOperator(int N, int storage,
+        const function<MatrixBase<double>*()>& build)
+    {
+      return find(operators, Key(N, storage), build);
+    }
+    
+    
+    /*  Description: Get Cholesky, looks up the factor of a mesh operator
+        Preconditions: build returns a new factor of the operator for N
+        Postconditions: returns the cached factor, calling build and
+                        storing the result the first time
+    */
+    shared_ptr<const CholeskyFactorization<double> > getCholesky(int N,
+        const function<CholeskyFactorization<double>*()>& build)
+    {
+      return find(choleskyFactors, Key(N, 0), build);
+    }
+    
+    
+    /*  Description: Get Incomplete Cholesky, looks up the IC(0)
+                     preconditioner of a mesh operator
+        Preconditions: build returns a new preconditioner for the operator
+                       for N in storage
+        Postconditions: returns the cached preconditioner, calling build
+                        and storing the result the first time
+    */
+    shared_ptr<const IncompleteCholesky<double> > getIncompleteCholesky(int N, int storage,
+        const function<IncompleteCholesky<double>*()>& build)
+    {
+      return find(incompleteFactors, Key(N, storage), build);
+    }
+    
+    
+    /*  Description: Clear, forgets every entry
+        Preconditions: None
+        Postconditions: the cache holds no entries, objects still held by
+                        solvers stay valid until they let go of them but
+                        are no longer handed out
+    */
+    void clear()
+    {
+      lock_guard<mutex> guard(lock);
+      operators.clear();
+      choleskyFactors.clear();
+      incompleteFactors.clear();
+      recent.clear();
+    }
+    
+    
+    /*  Description: Setter for the number of recent objects
+        Preconditions: newNumRecent >= 0
+        Postconditions: the cache keeps the newNumRecent most recently
+                        used objects alive, older ones are released
+    */
+    void setNumRecent(int newNumRecent)
+    {
+      lock_guard<mutex> guard(lock);
+      numRecent = newNumRecent;
+      while((int)recent.size() > numRecent) recent.pop_back();
+    }
+    
+    
+    /*  Description: Getter for the number of recent objects
+        Preconditions: None
+        Postconditions: returns how many of the most recently used objects
+                        the cache keeps alive
+    */
+    int getNumRecent()
+    {
+      lock_guard<mutex> guard(lock);
+      return numRecent;
+    }
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of cached objects that are
+                        still alive, held by a solver or kept as recent
+    */
+    int getSize()
+    {
+      lock_guard<mutex> guard(lock);
+      return live(operators) + live(choleskyFactors) + live(incompleteFactors);
+    }
+  
+  
+  private:
+    mutex lock;
+    map<Key, weak_ptr<const MatrixBase<double> > > operators;
+    map<Key, weak_ptr<const CholeskyFactorization<double> > > choleskyFactors;
+    map<Key, weak_ptr<const IncompleteCholesky<double> > > incompleteFactors;
+    // the most recently used objects of any kind, newest first
+    list<shared_ptr<const void> > recent;
+    int numRecent;
+    
+    // the entries are shared, so copying is not allowed
+    OperatorCache(const OperatorCache&);
+    OperatorCache& operator=(const OperatorCache&);
+    
+    
+    /*  Description: Find, looks up key in entries
+        Preconditions: build returns a new object for key
+        Postconditions: returns the object stored for key while it is
+                        alive, otherwise stores and returns what build
+                        returned, the object becomes the most recent and
+                        entries that are no longer alive are dropped
+    */
+    template<class E>
+    shared_ptr<const E> find(map<Key, weak_ptr<const E> >& entries, const Key& key,
+                             const function<E*()>& build)
+    {
+      {
+        lock_guard<mutex> guard(lock);
+        shared_ptr<const E> found = entries[key].lock();
+        if(found)
+        {
+          use(found);
+          return found;
+        }
+      }
+      shared_ptr<const E> built(build());
+      lock_guard<mutex> guard(lock);
+      // another thread may have stored the same entry in the meantime
+      shared_ptr<const E> found = entries[key].lock();
+      if(found)
+      {
+        use(found);
+        return found;
+      }
+      entries[key] = built;
+      use(built);
+      typename map<Key, weak_ptr<const E> >::iterator entry = entries.begin();
+      while(entry != entries.end())
+      {
+        if(entry->second.expired()) entries.erase(entry++);
+        else ++entry;
+      }
+      return built;
+    }
+    
+    
+    /*  Description: Use, marks an object as the most recently used
+        Preconditions: lock is held
+        Postconditions: object is first in recent, the objects past
+                        numRecent are released by the cache
+    */
+    void use(const shared_ptr<const void>& object)
+    {
+      list<shared_ptr<const void> >::iterator entry = recent.begin();
+      while(entry != recent.end() && entry->get() != object.get()) ++entry;
+      if(entry != recent.end()) recent.erase(entry);
+      recent.push_front(object);
+      while((int)recent.size() > numRecent) recent.pop_back();
+    }
+    
+    
+    /*  Description: Live, counts the entries that are still alive
+        Preconditions: lock is held
+        Postconditions: returns the number of entries that have not
+                        expired
+    */
+    template<class E>
+    static int live(const map<Key, weak_ptr<const E> >& entries)
+    {
+      int count = 0;
+      typename map<Key, weak_ptr<const E> >::const_iterator entry;
+      for(entry = entries.begin(); entry != entries.end(); ++entry)
+      {
+        if(!entry->second.expired()) count++;
+      }
+      return count;
+    }
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,202 @@
+/*
+  Filename:   PipelinedConjugateGradient.h
+  Author:     Raymond Hummel
+  Date:       5/30/2014
+  Purpose:    Contains the declaration of the PipelinedConjugateGradient
+              class
+*/
+
+#ifndef PIPELINEDCONJUGATEGRADIENT_H
+#define PIPELINEDCONJUGATEGRADIENT_H
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+
+#include "MatrixBase.h"
+#include "SymmetricMatrix.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+
+/*
+Conjugate gradients rearranged so an iteration waits for other threads
+only once. Plain CG needs r.r and p.Ap before it can take the next step,
+and p.Ap can not start until the product Ap is finished, so every
+iteration is a product, a reduction and another reduction, each ending at
+a barrier. Ghysels and Vanroose carry w = Ar and the directions s = Ap
+and z = As along by recurrences, so r.r, w.r and the product Aw are all
+taken from the same r and w. Here the product Aw, the vector updates and
+the next r.r, w.r and |r| are done together in one pass over each block
+of rows. The updated w goes into a second vector so no block overwrites w
+while another is still multiplying by it, and the two are swapped after
+the pass. The recurrences let rounding pull r away from b - Ax, so the
+true residual is checked before stopping and the iteration restarts
+from it when needed.
+*/
+template<class T>
+class PipelinedConjugateGradient
+{
+  public:
+    /*  Description: Constructor, starts the thread pool
+        Preconditions: None
+        Postconditions: iterations run on numThreads threads, numThreads
+                        < 1 uses one thread per hardware core
+    */
+    PipelinedConjugateGradient(int numThreads = 0)
+      :pool(numThreads), partials(3 * pool.getNumThreads()), iterations(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is symmetric positive definite
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is symmetric positive definite
+        Postconditions: x holds the approximate solution of Ax=b
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      if(!isSymmetric(A)) throw "Matrix A must be symmetric";
+      Norm<T> norm;
+      const int n = b.getSize();
+      Vector<T>& r = workspace(0, n);
+      Vector<T>& w = workspace(1, n);
+      Vector<T>& nextW = workspace(2, n);
+      Vector<T>& p = workspace(3, n);
+      Vector<T>& s = workspace(4, n);
+      Vector<T>& z = workspace(5, n);
+      double error = 0.0000001;
+      const int numBlocks = pool.getNumThreads() < n ? pool.getNumThreads() : (n > 0 ? n : 1);
+      T alpha = 0, beta = 0, gamma, delta, previousGamma = 0;
+      
+      // block k takes one step on the rows [k*n/numBlocks,
+      // (k+1)*n/numBlocks) and leaves its share of the next r.r, w.r and
+      // |r| in partials
+      function<void(int)> stepBlock = [&](int k)
+      {
+        T rr = 0, wr = 0, length = 0;
+        for(int i=k*n/numBlocks; i < (k+1)*n/numBlocks; i++)
+        {
+          // z = Aw + beta z is the only use of the product
+          z[i] = A.rowProduct(i, w) + beta * z[i];
+          s[i] = w[i] + beta * s[i];
+          p[i] = r[i] + beta * p[i];
+          x[i] += alpha * p[i];
+          r[i] -= alpha * s[i];
+          nextW[i] = w[i] - alpha * z[i];
+          rr += r[i] * r[i];
+          wr += nextW[i] * r[i];
+          length += abs(r[i]);
+        }
+        partials[3*k] = rr;
+        partials[3*k+1] = wr;
+        partials[3*k+2] = length;
+      };
+      
+      x.setSize(n);
+      x = 0;
+      r = b;
+      
+      iterations = 0;
+      
+      while(true)
+      {
+        //start, or restart, the recurrences from the true residual
+        A.multiply(r, w);
+        p = 0;
+        s = 0;
+        z = 0;
+        gamma = r * r;
+        delta = w * r;
+        T length = norm(r);
+        bool first = true;
+        
+        while(length > error)
+        {
+          if(delta == T(0)) throw "Matrix A must be positive definite";
+          if(first)
+          {
+            beta = 0;
+            alpha = gamma / delta;
+            first = false;
+          }
+          else
+          {
+            beta = gamma / previousGamma;
+            alpha = gamma / (delta - beta * gamma / alpha);
+          }
+          previousGamma = gamma;
+          
+          pool.run(numBlocks, stepBlock);
+          w.swap(nextW);
+          gamma = 0;
+          delta = 0;
+          length = 0;
+          for(int k=0; k < numBlocks; k++)
+          {
+            gamma += partials[3*k];
+            delta += partials[3*k+1];
+            length += partials[3*k+2];
+          }
+          
+          iterations++;
+          if(iterations > 5000) break;
+        }
+        
+        // the recurrences drift from b - Ax, only stop when the true
+        // residual is small too
+        A.multiply(x, r);
+        r = b - r;
+        if(norm(r) <= error) break;
+        if(iterations > 5000)
+        {
+          cout << "PipelinedConjugateGradient method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+    
+    
+    /*  Description: Getter for the number of threads
+        Preconditions: None
+        Postconditions: returns the threads an iteration is split across
+    */
+    int getNumThreads() const { return pool.getNumThreads(); }
+  
+  
+  private:
+    ThreadPool pool;
+    // r.r, w.r and |r| of each block during the current iteration, kept
+    // apart so the blocks never write to the same element
+    vector<T> partials;
+    int iterations;
+
+};
+
+#endif
\ No newline at end of file
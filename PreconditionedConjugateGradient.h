@@ -0,0 +1,115 @@
+/*
+  Filename:   PreconditionedConjugateGradient.h
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the declaration of the PreconditionedConjugateGradient
+              class
+*/
+
+#ifndef PRECONDITIONEDCONJUGATEGRADIENT_H
+#define PRECONDITIONEDCONJUGATEGRADIENT_H
+
+#include "MatrixBase.h"
+#include "SymmetricMatrix.h"
+#include "Preconditioner.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+
+template<class T>
+class PreconditionedConjugateGradient
+{
+  public:
+    /*  Description: Constructor, selects the preconditioner
+        Preconditions: preconditioner outlives the solver
+        Postconditions: every solve applies preconditioner once per
+                        iteration
+    */
+    explicit PreconditionedConjugateGradient(const Preconditioner<T>& preconditioner)
+      :M(preconditioner), iterations(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A is symmetric positive definite, the 
+                       preconditioner was set up for A
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is symmetric positive definite, the 
+                       preconditioner was set up for A
+        Postconditions: x holds the approximate solution of Ax=b
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      if(M.getSize() != b.getSize()) throw "Preconditioner and Vector b must be the same size.";
+      if(!isSymmetric(A)) throw "Matrix A must be symmetric";
+      Norm<T> norm;
+      int n = b.getSize();
+      Vector<T>& r = workspace(0, n);
+      Vector<T>& z = workspace(1, n);
+      Vector<T>& p = workspace(2, n);
+      Vector<T>& Ap = workspace(3, n);
+      double error = 0.0000001;
+      T alpha, rz, nextRZ;
+      
+      x.setSize(n);
+      x = 0;
+      r = b;
+      M.apply(r, z);
+      p = z;
+      rz = r * z;
+      
+      iterations = 0;
+      
+      while( norm(r) > error )
+      {
+        //step along p
+        A.multiply(p, Ap);
+        alpha = rz / (p * Ap);
+        x += p * alpha;
+        r -= Ap * alpha;
+        
+        //next direction from the preconditioned residual
+        M.apply(r, z);
+        nextRZ = r * z;
+        p = z + p * (nextRZ / rz);
+        rz = nextRZ;
+        
+        iterations++;
+        if(iterations > 5000) 
+        {
+          cout << "PreconditionedConjugateGradient method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+  
+  
+  private:
+    const Preconditioner<T>& M;
+    int iterations;
+
+};
+
+#endif
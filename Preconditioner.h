@@ -0,0 +1,60 @@
+/*
+  Filename:   Preconditioner.h
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the declaration of the Preconditioner interface
+*/
+
+#ifndef PRECONDITIONER_H
+#define PRECONDITIONER_H
+
+#include "MatrixBase.h"
+#include "Vector.h"
+
+using namespace std;
+
+
+/*
+A Preconditioner stands for a matrix M that is close to A but cheap to
+invert. Iterative solvers call apply to compute z = M^-1 r once per
+iteration. A preconditioner is built for one matrix by setup, and it can
+be reused for every solve with that matrix.
+*/
+template<class T>
+class Preconditioner
+{
+  public:
+    /*  Description: Destructor
+        Preconditions: None
+        Postconditions: all memory owned by the preconditioner is freed
+    */
+    virtual ~Preconditioner() {}
+    
+    
+    /*  Description: Setup, builds the preconditioner for a matrix
+        Preconditions: A is square
+        Postconditions: apply approximates the inverse of A
+    */
+    virtual void setup(const MatrixBase<T>& A) = 0;
+    
+    
+    /*  Description: Apply, solves Mz = r
+        Preconditions: setup has been called, r has getSize() elements,
+                       z is not the same object as r
+        Postconditions: z = M^-1 r, no storage is allocated when z
+                        already has the right size
+                        throws SizeError if r is the wrong size
+    */
+    virtual void apply(const Vector<T>& r, Vector<T>& z) const = 0;
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the matrix the
+                        preconditioner was built for
+    */
+    virtual int getSize() const = 0;
+
+};
+
+#endif
@@ -0,0 +1,138 @@
+/*
+  Filename:   RedBlackGaussSeidel.h
+  Author:     Raymond Hummel
+  Date:       5/21/2014
+  Purpose:    Contains the declaration of the RedBlackGaussSeidel class
+*/
+
+#ifndef REDBLACKGAUSSSEIDEL_H
+#define REDBLACKGAUSSSEIDEL_H
+
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "StencilOperator.h"
+#include "Vector.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+
+/*
+Gauss-Seidel for the 5-point stencil with the mesh points coloured like a
+checkerboard. A red point (x+y even) only couples to black points and the
+other way around, so all red points can be updated at once from the black
+values and then all black points from the new red values. Each colour is
+split into blocks of whole mesh lines that are swept on a ThreadPool.
+*/
+template<class T>
+class RedBlackGaussSeidel
+{
+  public:
+    /*  Description: Constructor, starts the thread pool
+        Preconditions: None
+        Postconditions: sweeps run on numThreads threads, numThreads < 1
+                        uses one thread per hardware core
+    */
+    RedBlackGaussSeidel(int numThreads = 0)
+      :pool(numThreads), changes(pool.getNumThreads()), sweeps(0) {}
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A has diagonal != 0
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const StencilOperator<T>& A, const Vector<T>& b)
+    {
+      Vector<T> x;
+      operator()(A, b, x);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b starting
+                     from zero
+        Preconditions: A has diagonal != 0
+        Postconditions: x holds the approximate solution of Ax=b, sweeps
+                        stop once a sweep changes x by less than 0.0000001
+                        throws SizeError if b does not match A
+    */
+    void operator()(const StencilOperator<T>& A, const Vector<T>& b, Vector<T>& x)
+    {
+      if(A.getNumRows() != b.getSize()) throw SizeError(b.getSize(), "RedBlackGaussSeidel");
+      x.setSize(b.getSize());
+      x = 0;
+      
+      const int m = A.getN() - 1;
+      const T diagonal = A.getDiagonal();
+      const T offDiagonal = A.getOffDiagonal();
+      T* u = x.data();
+      const T* f = b.data();
+      const int numBlocks = pool.getNumThreads() < m ? pool.getNumThreads() : m;
+      int colour = 0;
+      
+      // block k sweeps the lines [k*m/numBlocks, (k+1)*m/numBlocks) and adds
+      // the change of every point it updates to changes[k]
+      function<void(int)> sweepBlock = [&](int k)
+      {
+        T change = 0;
+        for(int y=k*m/numBlocks; y < (k+1)*m/numBlocks; y++)
+        {
+          for(int x=(y+colour)%2; x < m; x+=2)
+          {
+            int i = y*m + x;
+            T neighbours = 0;
+            if(y > 0) neighbours += u[i-m];
+            if(x > 0) neighbours += u[i-1];
+            if(x < m-1) neighbours += u[i+1];
+            if(y < m-1) neighbours += u[i+m];
+            T next = (f[i] - offDiagonal*neighbours) / diagonal;
+            change += abs(next - u[i]);
+            u[i] = next;
+          }
+        }
+        changes[k] += change;
+      };
+      
+      T change = 1;
+      sweeps = 0;
+      while(change > 0.0000001)
+      {
+        for(int k=0; k < numBlocks; k++) changes[k] = 0;
+        for(colour=0; colour < 2; colour++)
+        {
+          pool.run(numBlocks, sweepBlock);
+        }
+        change = 0;
+        for(int k=0; k < numBlocks; k++) change += changes[k];
+        sweeps++;
+      }
+    }
+    
+    
+    /*  Description: Getter for sweeps
+        Preconditions: None
+        Postconditions: returns the number of sweeps the last solve took
+    */
+    int getSweeps() const { return sweeps; }
+    
+    
+    /*  Description: Getter for the number of threads
+        Preconditions: None
+        Postconditions: returns the threads a sweep is split across
+    */
+    int getNumThreads() const { return pool.getNumThreads(); }
+  
+  
+  private:
+    ThreadPool pool;
+    // change of each block during the current sweep, kept apart so
+    // the blocks never write to the same element
+    vector<T> changes;
+    int sweeps;
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,270 @@
+/*
+  Filename:   SOR.h
+  Author:     Raymond Hummel
+  Date:       5/22/2014
+  Purpose:    Contains the declaration of the SOR class
+*/
+
+#ifndef SOR_H
+#define SOR_H
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+#include "MatrixBase.h"
+#include "SymmetricMatrix.h"
+#include "Norm.h"
+#include "SolverWorkspace.h"
+#include "LanczosBounds.h"
+
+using namespace std;
+
+
+/*
+Successive over-relaxation moves each unknown omega times as far as a
+Gauss-Seidel step would, so omega = 1 is Gauss-Seidel. When the Jacobi
+iteration of A has spectral radius rho the best omega is
+2/(1+sqrt(1-rho^2)). For the stencil with diagonal d and offDiagonal o on
+an N division mesh rho = |4o/d|cos(pi/N), which for the 4,-1 Laplacian is
+the familiar 2/(1+sin(pi/N)). For any other symmetric matrix rho is
+estimated with a few Lanczos steps, which find the extreme eigenvalues of
+D^-1 A. Lanczos relies on the symmetry, so for a nonsymmetric matrix rho
+is estimated by power iteration on the Jacobi matrix J = I - D^-1 A
+instead. When J is far from normal the few steps taken measure how fast
+J shrinks a vector early on, which can be above rho and gives an omega
+somewhat above the best one, and the formula assumes the Jacobi
+eigenvalues are real. An estimate of 1 or more falls back to
+Gauss-Seidel, omega = 1. The SYMMETRIC sweep follows each forward sweep
+with a backward one.
+*/
+template<class T>
+class SOR
+{
+  public:
+    // order of the unknowns in one iteration
+    enum Sweep { FORWARD, SYMMETRIC };
+    
+    
+    /*  Description: Constructor, selects the sweep and omega
+        Preconditions: omega == 0 or 0 < omega < 2
+        Postconditions: omega == 0 estimates omega from A on each solve
+                        throws if omega is out of range
+    */
+    SOR(Sweep sweep = FORWARD, const T& omega = 0)
+      :sweep(sweep), omega(0), automatic(true), iterations(0)
+    {
+      if(omega != T(0)) setOmega(omega);
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, returns solution of Ax=b
+        Preconditions: A has no element Aii == 0
+        Postconditions: returns Vector representing the approximate solution
+                        of Ax=b for x
+    */
+    Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A has no element Aii == 0
+        Postconditions: x holds the approximate solution of Ax=b, sweeps
+                        stop once an iteration changes x by less than
+                        0.0000001
+                        throws if A and b do not match or Aii == 0
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
+    {
+      if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
+      int n = b.getSize();
+      Vector<T>& diagonal = workspace(0, n);
+      for(int i=0; i < n; i++)
+      {
+        diagonal[i] = A(i,i);
+        if(diagonal[i] == T(0)) throw "SOR needs a nonzero diagonal";
+      }
+      if(automatic) omega = optimalOmega(estimateRadius(A, diagonal, workspace));
+      
+      x.setSize(n);
+      x = 0;
+      T change = 1;
+      iterations = 0;
+      while(change > 0.0000001)
+      {
+        change = 0;
+        for(int i=0; i < n; i++)
+        {
+          change += relax(A, b, x, diagonal, i);
+        }
+        if(sweep == SYMMETRIC)
+        {
+          for(int i=n-1; i >= 0; i--)
+          {
+            change += relax(A, b, x, diagonal, i);
+          }
+        }
+        iterations++;
+        if(iterations > 5000)
+        {
+          cout << "SOR method did not converge after 5000 iterations" << endl;
+          break;
+        }
+      }
+    }
+    
+    
+    /*  Description: Setter for omega
+        Preconditions: 0 < newOmega < 2
+        Postconditions: later solves use newOmega instead of an estimate
+                        throws if newOmega is out of range
+    */
+    void setOmega(const T& newOmega)
+    {
+      if( !(newOmega > 0 && newOmega < 2) ) throw "SOR needs 0 < omega < 2";
+      omega = newOmega;
+      automatic = false;
+    }
+    
+    
+    /*  Description: Mesh Omega, sets the best omega for a 5-point stencil
+                     without looking at the matrix
+        Preconditions: N > 1, |4o/d| < 1 after scaling by cos(pi/N)
+        Postconditions: later solves use the optimal omega for the stencil
+                        with diag and off on an N division mesh
+    */
+    void setMeshOmega(int N, const T& diag = 4, const T& off = -1)
+    {
+      const T pi = acos(T(-1));
+      T radius = abs(4*off/diag) * cos(pi/N);
+      setOmega(optimalOmega(radius));
+    }
+    
+    
+    /*  Description: Automatic Omega, estimates omega from the matrix
+        Preconditions: None
+        Postconditions: later solves estimate omega from their matrix
+    */
+    void setAutomaticOmega() { automatic = true; }
+    
+    
+    /*  Description: Getter for omega
+        Preconditions: None
+        Postconditions: returns the omega of the last solve, or the one
+                        that was set
+    */
+    const T& getOmega() const { return omega; }
+    
+    
+    /*  Description: Getter for iterations
+        Preconditions: None
+        Postconditions: returns the number of iterations the last solve took
+    */
+    int getIterations() const { return iterations; }
+    
+    
+    /*  Description: Optimal Omega, the best omega for a Jacobi spectral
+                     radius
+        Preconditions: 0 <= radius < 1
+        Postconditions: returns 2/(1+sqrt(1-radius^2)), or 1 when the
+                        radius is out of range
+    */
+    static T optimalOmega(const T& radius)
+    {
+      if( !(radius >= 0 && radius < 1) ) return 1;
+      return 2 / (1 + sqrt(1 - radius*radius));
+    }
+  
+  
+  private:
+    Sweep sweep;
+    T omega;
+    bool automatic;
+    int iterations;
+    
+    
+    /*  Description: Relax, moves one unknown omega times its Gauss-Seidel
+                     step
+        Preconditions: diagonal holds the diagonal of A
+        Postconditions: x[i] is updated, returns the size of its change
+    */
+    T relax(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+            const Vector<T>& diagonal, int i) const
+    {
+      // the row product includes the diagonal, so b - Ax is the residual
+      T step = omega * (b[i] - A.rowProduct(i,x)) / diagonal[i];
+      x[i] += step;
+      return abs(step);
+    }
+    
+    
+    /*  Description: Estimate Radius, finds the spectral radius of the
+                     Jacobi iteration J = I - D^-1 A, from a few Lanczos
+                     steps on D^-1/2 A D^-1/2, which has the eigenvalues
+                     of D^-1 A, when A is symmetric and by power iteration
+                     on J otherwise
+        Preconditions: diagonal holds the diagonal of A
+        Postconditions: returns an estimate of the spectral radius, slots
+                        1 to 4 of workspace are overwritten
+    */
+    T estimateRadius(const MatrixBase<T>& A, const Vector<T>& diagonal,
+                     SolverWorkspace<T>& workspace) const
+    {
+      if(isSymmetric(A))
+      {
+        LanczosBounds<T> bounds;
+        bounds(A, diagonal, workspace, 1);
+        return max(abs(1 - bounds.getSmallest()), abs(bounds.getLargest() - 1));
+      }
+      
+      int n = diagonal.getSize();
+      int steps = max(LANCZOS_STEPS, int(sqrt(T(n))));
+      Vector<T>& v = workspace(1, n);
+      Vector<T>& w = workspace(2, n);
+      Norm<T> norm;
+      v = 1;
+      T radius = 0;
+      for(int k=0; k < steps; k++)
+      {
+        T length = norm(v);
+        if(length == T(0)) return 0;
+        v *= 1 / length;
+        // J is applied twice per step, eigenvalues rho and -rho would
+        // make the length of a single step swing between them
+        jacobiStep(A, diagonal, v, w);
+        jacobiStep(A, diagonal, w, v);
+        radius = sqrt(norm(v));
+      }
+      return radius;
+    }
+    
+    
+    /*  Description: Jacobi Step, multiplies by the Jacobi matrix
+        Preconditions: diagonal holds the diagonal of A, from and to have
+                       its size
+        Postconditions: to = (I - D^-1 A) from
+    */
+    void jacobiStep(const MatrixBase<T>& A, const Vector<T>& diagonal,
+                    const Vector<T>& from, Vector<T>& to) const
+    {
+      A.multiply(from, to);
+      for(int i=0; i < diagonal.getSize(); i++)
+      {
+        to[i] = from[i] - to[i] / diagonal[i];
+      }
+    }
+
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+  Filename:   SSORPreconditioner.h
+  Author:     Raymond Hummel
+  Date:       5/19/2014
+  Purpose:    Contains the definition and implementation of the 
+              SSORPreconditioner class
+*/
+
+#ifndef SSORPRECONDITIONER_H
+#define SSORPRECONDITIONER_H
+
+#include "Preconditioner.h"
+#include "Error.h"
+
+
+/*
+With A = L + D + U, symmetric successive over-relaxation uses
+M = (D + wL) D^-1 (D + wU) / (w(2-w)), one forward and one backward 
+Gauss-Seidel sweep. With w = 1 this is symmetric Gauss-Seidel. Each sweep
+fills a vector that starts at zero, so rowProduct on it only picks up the
+rows already swept and only visits the elements A stores. The matrix is
+referenced, not copied, and must outlive the preconditioner.
+*/
+template<class T>
+class SSORPreconditioner: public Preconditioner<T>
+{
+  public:
+    /*  Description: Constructor, builds the preconditioner for A
+        Preconditions: A is symmetric with no element Aii == 0
+                       0 < omega < 2
+        Postconditions: apply performs one SSOR sweep pair with omega
+                        throws if omega is out of range
+    */
+    SSORPreconditioner(const MatrixBase<T>& A, const T& omega = 1)
+      :A(NULL), omega(omega)
+    {
+      if( !(omega > 0 && omega < 2) ) throw "SSORPreconditioner needs 0 < omega < 2";
+      setup(A);
+    }
+    
+    
+    /*  Description: Setup, references A and stores its diagonal
+        Preconditions: A has no element Aii == 0, A outlives the 
+                       preconditioner
+        Postconditions: apply performs one SSOR sweep pair on A
+                        throws if a diagonal element is zero
+    */
+    virtual void setup(const MatrixBase<T>& A)
+    {
+      if(A.getNumRows() != A.getNumCols()) throw SizeError(A.getNumCols(), "SSORPreconditioner");
+      this->A = &A;
+      diagonal.setSize(A.getNumRows());
+      sweep.setSize(A.getNumRows());
+      for(int i=0; i < A.getNumRows(); i++)
+      {
+        if(A(i,i) == T(0)) throw "SSORPreconditioner needs a nonzero diagonal";
+        diagonal[i] = A(i,i);
+      }
+    }
+    
+    
+    /*  Description: Apply, solves Mz = r with a forward and a backward
+                     sweep
+        Preconditions: r has getSize() elements, z is not r
+        Postconditions: z = M^-1 r
+    */
+    virtual void apply(const Vector<T>& r, Vector<T>& z) const
+    {
+      int n = getSize();
+      if(r.getSize() != n) throw SizeError(r.getSize(), "SSORPreconditioner apply");
+      // forward sweep, (D + wL)y = r
+      sweep = 0;
+      for(int i=0; i < n; i++)
+      {
+        sweep[i] = (r[i] - omega*A->rowProduct(i,sweep)) / diagonal[i];
+      }
+      // backward sweep, (D + wU)z = w(2-w)Dy
+      T scale = omega*(2-omega);
+      z.setSize(n);
+      z = 0;
+      for(int i=n-1; i >= 0; i--)
+      {
+        z[i] = (scale*diagonal[i]*sweep[i] - omega*A->rowProduct(i,z)) / diagonal[i];
+      }
+    }
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the number of rows of the matrix
+    */
+    virtual int getSize() const { return diagonal.getSize(); }
+  
+  
+  private:
+    const MatrixBase<T>* A;
+    T omega;
+    Vector<T> diagonal;
+    // result of the forward sweep, kept so apply does not allocate, which
+    // means one preconditioner must not be applied by two threads at once
+    mutable Vector<T> sweep;
+
+};
+
+#endif
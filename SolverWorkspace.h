@@ -0,0 +1,92 @@
+/*
+  Filename:   SolverWorkspace.h
+  Author:     Raymond Hummel
+  Date:       5/16/2014
+  Purpose:    Contains the definition and implementation of the
+              SolverWorkspace class
+*/
+
+#ifndef SOLVERWORKSPACE_H
+#define SOLVERWORKSPACE_H
+
+#include <deque>
+
+#include "Vector.h"
+#include "Error.h"
+
+using namespace std;
+
+
+/*
+A SolverWorkspace holds the scratch vectors an iterative solver needs.
+Each solver asks for its scratch by slot number, a slot keeps its storage
+between requests, so once every slot has been sized for a problem the
+solver can iterate and solve again without touching the heap. Slots are
+kept in a deque so references handed out earlier stay valid when more
+slots are added.
+*/
+template<class T>
+class SolverWorkspace
+{
+  public:
+    /*  Description: Default Constructor, creates an empty workspace
+        Preconditions: None
+        Postconditions: the workspace holds no scratch vectors
+    */
+    SolverWorkspace() {}
+    
+    
+    /*  Description: Pre-Sized Constructor, allocates every scratch vector
+                     up front
+        Preconditions: numSlots >= 0, n >= 0
+        Postconditions: slots 0 through numSlots-1 are vectors of size n
+    */
+    SolverWorkspace(int numSlots, int n) { reserve(numSlots, n); }
+    
+    
+    /*  Description: Scratch Vector Access, returns a scratch vector of
+                     the requested size
+        Preconditions: slot >= 0, n >= 0
+        Postconditions: returns the vector stored in slot with size n,
+                        storage is only allocated when the slot is new or
+                        the size changed, the contents are unspecified
+                        throws RangeError if slot < 0
+    */
+    Vector<T>& operator()(int slot, int n)
+    {
+      if(slot < 0) throw RangeError(slot, "SolverWorkspace slot");
+      while(static_cast<int>(scratch.size()) <= slot)
+      {
+        scratch.push_back(Vector<T>());
+      }
+      scratch[slot].setSize(n);
+      return scratch[slot];
+    }
+    
+    
+    /*  Description: Reserve, sizes a group of slots before solving
+        Preconditions: numSlots >= 0, n >= 0
+        Postconditions: slots 0 through numSlots-1 are vectors of size n
+    */
+    void reserve(int numSlots, int n)
+    {
+      for(int i=0; i < numSlots; i++)
+      {
+        operator()(i, n);
+      }
+    }
+    
+    
+    /*  Description: Getter for the number of slots
+        Preconditions: None
+        Postconditions: returns the number of scratch vectors held
+    */
+    int getNumSlots() const { return scratch.size(); }
+  
+  
+  private:
+    deque<Vector<T> > scratch;
+
+};
+
+#endif
\ No newline at end of file
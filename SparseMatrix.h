@@ -0,0 +1,272 @@
+/*
+  Filename:   SparseMatrix.h
+  Author:     Raymond Hummel
+  Date:       5/12/2014
+  Purpose:    Contains the declaration of the SparseMatrix class, a
+              compressed sparse row (CSR) implementation of MatrixBase
+*/
+
+#ifndef SPARSEMATRIX_H
+#define SPARSEMATRIX_H
+
+#include <vector>
+#include <algorithm>
+
+#include "MatrixBase.h"
+
+
+template<class T>
+class SparseMatrix: public virtual MatrixBase<T>
+{
+  public:
+    /*  Description: Default Constructor, creates empty SparseMatrix
+        Preconditions: None
+        Postconditions: numRows, numCols, numNonzeros all equal 0
+    */
+    SparseMatrix():numRows(0), numCols(0), rowStart(1,0), zero(0) {}
+    
+    
+    /*  Description: Pre-Sized Constructor, creates SparseMatrix of size n by n
+        Preconditions: n must be a positive, non-zero integer
+        Postconditions: numRows = n, numCols = n, no elements are stored,
+                        throws a SizeError exception if n < 0
+    */
+    SparseMatrix(int n);
+    
+    
+    /*  Description: Pre-Sized Constructor, creates SparseMatrix of size
+                     rows by cols
+        Preconditions: rows, cols must be positive, non-zero integers
+        Postconditions: numRows = rows, numCols = cols, no elements are
+                        stored, throws a SizeError exception if rows or
+                        cols < 0
+    */
+    SparseMatrix(int rows, int cols);
+    
+    
+    /*  Description: CSR Constructor, adopts already compressed storage
+        Preconditions: starts has rows+1 entries, starting at 0 and
+                       non-decreasing, columns and vals have starts[rows]
+                       entries, column indices are increasing in each row
+        Postconditions: calling object holds the given elements,
+                        throws a SizeError if the arrays are inconsistent
+                        throws a RangeError if a column index is out of range
+                        or the columns of a row are not strictly increasing
+    */
+    SparseMatrix(int rows, int cols, const vector<int>& starts,
+                 const vector<int>& columns, const vector<T>& vals);
+    
+    
+    /*  Description: Base Constructor, compresses any matrix
+        Preconditions: T must be comparable to 0
+        Postconditions: calling object stores every nonzero element of
+                        original
+    */
+    explicit SparseMatrix(const MatrixBase<T>& original);
+    
+    
+    /*  Description: Matrix Subscripting Operator, provides access to
+                     elements of the matrix
+        Preconditions: row, col are positive integers between
+                       0 and numRows or numCols respectively
+                       calling object is not const
+        Postconditions: returns a reference to the element at row, col,
+                        an element that is not stored is inserted first,
+                        which costs O(numNonzeros)
+                        throws a RangeError if row,col < 0 or row >= numRows
+                        or col >= numCols
+    */
+    virtual T& operator()(int row, int col);
+    
+    
+    /*  Description: const Matrix Subscripting Operator, provides read-only
+                     access to elements of the matrix
+        Preconditions: row, col are positive integers between
+                       0 and numRows or numCols respectively
+        Postconditions: returns a const reference to the element at row, col
+                        or to zero if the element is not stored
+                        throws a RangeError if row,col < 0 or row >= numRows
+                        or col >= numCols
+    */
+    virtual const T& operator()(int row, int col) const;
+    
+    
+    /*  Description: Matrix Addition, adds matrices
+        Preconditions: T must have a defined addition operator
+                       T must have a defined copy assignment operator
+        Postconditions: returns matrix that is element-wise
+                        sum of calling object and rhs,
+                        throws a SizeError if rhs has a different number
+                        of rows or columns
+    */
+    virtual MatrixBase<T>& operator+=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Matrix Subtraction, subtracts matrices
+        Preconditions: T must have a defined subtraction operator
+                       T must have a defined copy assignment operator
+        Postconditions: returns matrix that is element-wise
+                        difference of calling object and rhs,
+                        throws a SizeError if rhs has a different number
+                        of rows or columns
+    */
+    virtual MatrixBase<T>& operator-=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Scalar Multiplication, multiplies all elements of the
+                     matrix by the parameter value
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined copy assignment operator
+        Postconditions: returns matrix with every element containing the
+                        calling object's element multiplied by rhs
+    */
+    virtual MatrixBase<T>& operator*=(const T& rhs);
+    
+    
+    /*  Description: Matrix Multiplication, performs matrix multiplication and
+                     returns the result
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+                       T must have a defined copy assignment operator
+        Postconditions: returns matrix multiplication product with
+                        size = numRows x rhs.numCols
+                        throws SizeError if numCol != rhs.numRows
+    */
+    virtual MatrixBase<T>& operator*=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Vector Multiplication, multiplies the matrix by a vector
+                     and returns the resulting vector in O(numNonzeros)
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+                       T must have a defined copy assignment operator
+        Postconditions: returns vector multiplication product with
+                        size = numRows x 1
+                        throws SizeError if numCol != rhs.numRows
+    */
+    virtual Vector<T> operator*(const Vector<T>& rhs) const;
+    
+    
+    /*  Description: Getter for the columns of calling object
+        Preconditions: None
+        Postconditions: returns the column referenced by columnIndex
+    */
+    virtual Vector<T> getColumn(int colIndex) const;
+    
+    
+    /*  Description: Getter for the rows of calling object
+        Preconditions: None
+        Postconditions: returns the row referenced by rowIndex
+    */
+    virtual Vector<T> getRow(int rowIndex) const;
+    
+    
+    /*  Description: Getter for numRows
+        Preconditions: None
+        Postconditions: returns the number of rows in the matrix
+    */
+    virtual int getNumRows() const { return numRows; }
+    
+    
+    /*  Description: Getter for numCols
+        Preconditions: None
+        Postconditions: returns the number of columns in the matrix
+    */
+    virtual int getNumCols() const { return numCols; }
+    
+    
+    /*  Description: Getter for the number of stored elements
+        Preconditions: None
+        Postconditions: returns the number of stored elements
+    */
+    int getNumNonzeros() const { return rowStart[numRows]; }
+    
+    
+    /*  Description: Determines if matrix is diagonally dominant
+        Preconditions: None
+        Postconditions: returns true if Aii > |Aij| for j!=i, else false
+    */
+    virtual bool isDiagonallyDominant() const;
+    
+    
+    /*  Description: Determines if matrix is symmetric in O(numNonzeros)
+        Preconditions: None
+        Postconditions: returns true if Aij == Aji for all i,j, else false
+    */
+    virtual bool symmetric() const;
+    
+    
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector, only visiting stored elements
+        Preconditions: None
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
+    /*  Description: Row Nonzeros, copies the stored elements of one row
+        Preconditions: 0 <= rowIndex < numRows
+        Postconditions: columns and elements hold the stored elements
+                        of row rowIndex in column order
+                        throws RangeError if rowIndex is out of range
+    */
+    virtual void getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& elements) const;
+    
+    
+    /*  Description: Swap, exchanges the elements of two matrices without
+                     copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of other and
+                        vice versa
+    */
+    void swap(SparseMatrix<T>& other) noexcept;
+    
+    
+    /*  Description: Setter for size
+        Preconditions: rows and cols must be positive non-zero integers
+        Postconditions: numRows = rows, numCols = cols, no elements
+                        are stored
+    */
+    void setSize(int rows, int cols);
+  
+  
+  private:
+    int numRows, numCols;
+    // index of the first element of each row, rowStart[numRows] = nonzeros
+    vector<int> rowStart;
+    // column of each stored element
+    vector<int> columnIndex;
+    // value of each stored element
+    vector<T> values;
+    // referenced by const operator() for elements that are not stored
+    T zero;
+    
+    
+    /*  Description: Find, locates a stored element
+        Preconditions: row, col are in range
+        Postconditions: returns the index of row, col in values,
+                        or -1 if the element is not stored
+    */
+    int find(int row, int col) const;
+    
+    
+    /*  Description: Combine, adds scale*rhs to the calling object
+        Preconditions: rhs is the same size as the calling object
+        Postconditions: storage is merged with the nonzeros of rhs
+    */
+    void combine(const MatrixBase<T>& rhs, const T& scale);
+
+};
+
+
+/*  Description: Swap, exchanges the elements of two matrices without
+                 copying them
+    Preconditions: None
+    Postconditions: a holds the elements of b and vice versa
+*/
+template<class T>
+void swap(SparseMatrix<T>& a, SparseMatrix<T>& b) noexcept { a.swap(b); }
+
+#include "SparseMatrix.hpp"
+#endif
\ No newline at end of file
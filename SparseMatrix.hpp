@@ -0,0 +1,402 @@
+/*
+  Filename:   SparseMatrix.hpp
+  Author:     Raymond Hummel
+  Date:       5/12/2014
+  Purpose:    Contains the implementation of the SparseMatrix class
+*/
+
+
+template<class T>
+SparseMatrix<T>::SparseMatrix(int n):numRows(0), numCols(0), rowStart(1,0), zero(0)
+{
+  setSize(n,n);
+}
+
+
+template<class T>
+SparseMatrix<T>::SparseMatrix(int rows, int cols):numRows(0), numCols(0), rowStart(1,0), zero(0)
+{
+  setSize(rows,cols);
+}
+
+
+template<class T>
+SparseMatrix<T>::SparseMatrix(int rows, int cols, const vector<int>& starts,
+                              const vector<int>& columns, const vector<T>& vals)
+  :numRows(rows), numCols(cols), rowStart(starts), columnIndex(columns), values(vals), zero(0)
+{
+  if(rows < 0) throw SizeError(rows, "CSR constructor: row");
+  if(cols < 0) throw SizeError(cols, "CSR constructor: col");
+  if(int(rowStart.size()) != rows+1) throw SizeError(rowStart.size(), "CSR constructor: rowStart");
+  if(rowStart[0] != 0) throw SizeError(rowStart[0], "CSR constructor: rowStart");
+  for(int i=0; i < rows; i++)
+  {
+    if(rowStart[i+1] < rowStart[i]) throw SizeError(rowStart[i+1], "CSR constructor: rowStart");
+  }
+  if(int(columnIndex.size()) != rowStart[rows]) throw SizeError(columnIndex.size(), "CSR constructor: columnIndex");
+  if(int(values.size()) != rowStart[rows]) throw SizeError(values.size(), "CSR constructor: values");
+  for(int i=0; i < rows; i++)
+  {
+    for(int k=rowStart[i]; k < rowStart[i+1]; k++)
+    {
+      if(columnIndex[k] < 0 || columnIndex[k] >= cols) throw RangeError(columnIndex[k], "CSR constructor: col");
+      // lookups binary search the columns of a row, so they must be
+      // strictly increasing
+      if(k > rowStart[i] && columnIndex[k] <= columnIndex[k-1]) throw RangeError(columnIndex[k], "CSR constructor: column order");
+    }
+  }
+}
+
+
+template<class T>
+SparseMatrix<T>::SparseMatrix(const MatrixBase<T>& original):numRows(0), numCols(0), rowStart(1,0), zero(0)
+{
+  setSize(original.getNumRows(), original.getNumCols());
+  for(int i=0; i < numRows; i++)
+  {
+    for(int j=0; j < numCols; j++)
+    {
+      if(original(i,j) != zero)
+      {
+        columnIndex.push_back(j);
+        values.push_back(original(i,j));
+      }
+    }
+    rowStart[i+1] = values.size();
+  }
+}
+
+
+template<class T>
+T& SparseMatrix<T>::operator()(int row, int col)
+{
+  if(row < 0 || row >= numRows) throw RangeError(row,"operator(): row");
+  if(col < 0 || col >= numCols) throw RangeError(col,"operator(): col");
+  vector<int>::iterator first = columnIndex.begin() + rowStart[row];
+  vector<int>::iterator last = columnIndex.begin() + rowStart[row+1];
+  vector<int>::iterator pos = lower_bound(first, last, col);
+  int k = pos - columnIndex.begin();
+  if(pos == last || *pos != col)
+  {
+    // element is not stored yet, make room for it
+    columnIndex.insert(pos, col);
+    values.insert(values.begin() + k, zero);
+    for(int i=row+1; i <= numRows; i++)
+    {
+      rowStart[i]++;
+    }
+  }
+  return values[k];
+}
+
+
+template<class T>
+const T& SparseMatrix<T>::operator()(int row, int col) const
+{
+  if(row < 0 || row >= numRows) throw RangeError(row,"operator(): const row");
+  if(col < 0 || col >= numCols) throw RangeError(col,"operator(): const col");
+  int k = find(row, col);
+  if(k < 0) return zero;
+  return values[k];
+}
+
+
+template<class T>
+MatrixBase<T>& SparseMatrix<T>::operator+=(const MatrixBase<T>& rhs)
+{
+  if( numRows != rhs.getNumRows() ) throw SizeError(numRows, "operator+= row");
+  if( numCols != rhs.getNumCols() ) throw SizeError(numCols, "operator+= col");
+  combine(rhs, T(1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& SparseMatrix<T>::operator-=(const MatrixBase<T>& rhs)
+{
+  if( numRows != rhs.getNumRows() ) throw SizeError(numRows, "operator-= row");
+  if( numCols != rhs.getNumCols() ) throw SizeError(numCols, "operator-= col");
+  combine(rhs, T(-1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& SparseMatrix<T>::operator*=(const T& rhs)
+{
+  for(int k=0; k < int(values.size()); k++)
+  {
+    values[k] = values[k] * rhs;
+  }
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& SparseMatrix<T>::operator*=(const MatrixBase<T>& rhs)
+{
+  if( numCols != rhs.getNumRows() ) throw SizeError(numCols, "operator*= matrix");
+  const SparseMatrix<T>* sparse = dynamic_cast<const SparseMatrix<T>*>(&rhs);
+  const int cols = rhs.getNumCols();
+  vector<int> newStart(numRows+1, 0);
+  vector<int> newIndex;
+  vector<T> newValues;
+  Vector<T> accumulator(cols);
+  vector<bool> touched(cols, false);
+  vector<int> pattern;
+  accumulator = 0;
+  
+  // row i of the product is the sum of a_ik * (row k of rhs)
+  for(int i=0; i < numRows; i++)
+  {
+    for(int k=rowStart[i]; k < rowStart[i+1]; k++)
+    {
+      const int inner = columnIndex[k];
+      if(sparse)
+      {
+        for(int m=sparse->rowStart[inner]; m < sparse->rowStart[inner+1]; m++)
+        {
+          const int j = sparse->columnIndex[m];
+          accumulator[j] += values[k] * sparse->values[m];
+          if(!touched[j]) { touched[j] = true; pattern.push_back(j); }
+        }
+      }
+      else
+      {
+        for(int j=0; j < cols; j++)
+        {
+          accumulator[j] += values[k] * rhs(inner,j);
+          if(!touched[j]) { touched[j] = true; pattern.push_back(j); }
+        }
+      }
+    }
+    sort(pattern.begin(), pattern.end());
+    for(int m=0; m < int(pattern.size()); m++)
+    {
+      const int j = pattern[m];
+      if(accumulator[j] != zero)
+      {
+        newIndex.push_back(j);
+        newValues.push_back(accumulator[j]);
+      }
+      accumulator[j] = 0;
+      touched[j] = false;
+    }
+    pattern.clear();
+    newStart[i+1] = newValues.size();
+  }
+  
+  numCols = cols;
+  rowStart.swap(newStart);
+  columnIndex.swap(newIndex);
+  values.swap(newValues);
+  return *this;
+}
+
+
+template<class T>
+Vector<T> SparseMatrix<T>::operator*(const Vector<T>& rhs) const
+{
+  if( numCols != rhs.getSize() ) throw SizeError(rhs.getSize(), "operator* vector");
+  Vector<T> retVal(numRows);
+  for(int i=0; i < numRows; i++)
+  {
+    T sum = 0;
+    for(int k=rowStart[i]; k < rowStart[i+1]; k++)
+    {
+      sum += values[k] * rhs[columnIndex[k]];
+    }
+    retVal[i] = sum;
+  }
+  return retVal;
+}
+
+
+template<class T>
+Vector<T> SparseMatrix<T>::getColumn(int colIndex) const
+{
+  if(colIndex < 0 || colIndex >= numCols) throw RangeError(colIndex, "getColumn");
+  Vector<T> column(numRows);
+  for(int i=0; i < numRows; i++)
+  {
+    int k = find(i, colIndex);
+    column[i] = (k < 0) ? zero : values[k];
+  }
+  return column;
+}
+
+
+template<class T>
+Vector<T> SparseMatrix<T>::getRow(int rowIndex) const
+{
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "getRow");
+  Vector<T> row(numCols);
+  row = 0;
+  for(int k=rowStart[rowIndex]; k < rowStart[rowIndex+1]; k++)
+  {
+    row[columnIndex[k]] = values[k];
+  }
+  return row;
+}
+
+
+template<class T>
+bool SparseMatrix<T>::isDiagonallyDominant() const
+{
+  for(int i=0; i < numRows; i++)
+  {
+    T sum = 0;
+    T diagonal = 0;
+    for(int k=rowStart[i]; k < rowStart[i+1]; k++)
+    {
+      if(columnIndex[k] == i) diagonal = abs(values[k]);
+      else sum += abs(values[k]);
+    }
+    if( sum > diagonal ) return false;
+  }
+  return true;
+}
+
+
+template<class T>
+bool SparseMatrix<T>::symmetric() const
+{
+  if(numRows != numCols) return false;
+  for(int i=0; i < numRows; i++)
+  {
+    for(int k=rowStart[i]; k < rowStart[i+1]; k++)
+    {
+      int mirror = find(columnIndex[k], i);
+      T other = (mirror < 0) ? zero : values[mirror];
+      if(values[k] != other) return false;
+    }
+  }
+  return true;
+}
+
+
+template<class T>
+T SparseMatrix<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if( numCols != x.getSize() ) throw SizeError(x.getSize(), "rowProduct");
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "rowProduct");
+  T retVal = 0;
+  for(int k=rowStart[rowIndex]; k < rowStart[rowIndex+1]; k++)
+  {
+    retVal += values[k] * x[columnIndex[k]];
+  }
+  return retVal;
+}
+
+
+template<class T>
+void SparseMatrix<T>::getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& elements) const
+{
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "getRowNonzeros");
+  columns.assign(columnIndex.begin() + rowStart[rowIndex], columnIndex.begin() + rowStart[rowIndex+1]);
+  elements.assign(values.begin() + rowStart[rowIndex], values.begin() + rowStart[rowIndex+1]);
+}
+
+
+template<class T>
+void SparseMatrix<T>::setSize(int rows, int cols)
+{
+  if(rows < 0) throw SizeError(rows, "setSize: row");
+  if(cols < 0) throw SizeError(cols, "setSize: col");
+  numRows = rows;
+  numCols = cols;
+  rowStart.assign(numRows+1, 0);
+  columnIndex.clear();
+  values.clear();
+}
+
+
+template<class T>
+void SparseMatrix<T>::swap(SparseMatrix<T>& other) noexcept
+{
+  int tempRows = numRows;
+  int tempCols = numCols;
+  numRows = other.numRows;
+  numCols = other.numCols;
+  other.numRows = tempRows;
+  other.numCols = tempCols;
+  rowStart.swap(other.rowStart);
+  columnIndex.swap(other.columnIndex);
+  values.swap(other.values);
+}
+
+
+template<class T>
+int SparseMatrix<T>::find(int row, int col) const
+{
+  vector<int>::const_iterator first = columnIndex.begin() + rowStart[row];
+  vector<int>::const_iterator last = columnIndex.begin() + rowStart[row+1];
+  vector<int>::const_iterator pos = lower_bound(first, last, col);
+  if(pos == last || *pos != col) return -1;
+  return pos - columnIndex.begin();
+}
+
+
+template<class T>
+void SparseMatrix<T>::combine(const MatrixBase<T>& rhs, const T& scale)
+{
+  const SparseMatrix<T>* sparse = dynamic_cast<const SparseMatrix<T>*>(&rhs);
+  vector<int> newStart(numRows+1, 0);
+  vector<int> newIndex;
+  vector<T> newValues;
+  newIndex.reserve(columnIndex.size());
+  newValues.reserve(values.size());
+  
+  for(int i=0; i < numRows; i++)
+  {
+    int k = rowStart[i];
+    if(sparse)
+    {
+      // merge two sorted rows
+      int m = sparse->rowStart[i];
+      while(k < rowStart[i+1] || m < sparse->rowStart[i+1])
+      {
+        int mine = (k < rowStart[i+1]) ? columnIndex[k] : numCols;
+        int theirs = (m < sparse->rowStart[i+1]) ? sparse->columnIndex[m] : numCols;
+        if(mine < theirs)
+        {
+          newIndex.push_back(mine);
+          newValues.push_back(values[k++]);
+        }
+        else if(theirs < mine)
+        {
+          newIndex.push_back(theirs);
+          newValues.push_back(scale * sparse->values[m++]);
+        }
+        else
+        {
+          newIndex.push_back(mine);
+          newValues.push_back(values[k++] + scale * sparse->values[m++]);
+        }
+      }
+    }
+    else
+    {
+      for(int j=0; j < numCols; j++)
+      {
+        const bool stored = (k < rowStart[i+1] && columnIndex[k] == j);
+        const T other = rhs(i,j);
+        if(stored)
+        {
+          newIndex.push_back(j);
+          newValues.push_back(values[k++] + scale * other);
+        }
+        else if(other != zero)
+        {
+          newIndex.push_back(j);
+          newValues.push_back(scale * other);
+        }
+      }
+    }
+    newStart[i+1] = newValues.size();
+  }
+  
+  rowStart.swap(newStart);
+  columnIndex.swap(newIndex);
+  values.swap(newValues);
+}
\ No newline at end of file
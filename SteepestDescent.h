@@ -11,40 +11,64 @@
 #include "MatrixBase.h"
 #include "SymmetricMatrix.h"
 #include "Norm.h"
+#include "SolverWorkspace.h"
 
 template<class T>
 class SteepestDescent
 {
   public:
     Vector<T> operator()(const MatrixBase<T>& A, const Vector<T>& b)
+    {
+      SolverWorkspace<T> workspace;
+      Vector<T> x;
+      operator()(A, b, x, workspace);
+      return x;
+    }
+    
+    
+    /*  Description: Function Evaluation Operator, solves Ax=b using the
+                     scratch vectors of workspace, no vector storage is
+                     allocated when x and workspace were already used for
+                     a problem of the same size
+        Preconditions: A is symmetric and diagonally dominant
+        Postconditions: x holds the approximate solution of Ax=b
+    */
+    void operator()(const MatrixBase<T>& A, const Vector<T>& b, Vector<T>& x,
+                    SolverWorkspace<T>& workspace)
     {
       if(A.getNumRows() != b.getSize()) throw "Matrix A and Vector b must be the same size.";
       if(!isSymmetric(A)) throw "Matrix A must be symmetric";
       if(!A.isDiagonallyDominant()) throw "Matrix A must be diagonally dominant";
       Norm<T> norm;
-      Vector<T> x(b);
-      Vector<T> d(b.getSize());
+      int n = b.getSize();
+      Vector<T>& d = workspace(0, n);
+      // holds A*x while finding d and A*d while finding the step
+      Vector<T>& product = workspace(1, n);
       double error = 0.0000001;
       T numerator = 0;
       T denominator = 0;
       
-      d = ( (A*x) - b )* -1;
+      x = b;
+      A.multiply(x, product);
+      d = b - product;
       
       int count = 0;
       
       while( norm(d) > error )
       {
         //numerator
-        numerator = norm(d)*norm(d);
+        numerator = d * d;
         
         //denominator
-        denominator = d * (A*d);
+        A.multiply(d, product);
+        denominator = d * product;
         
         //new x
-        x = x + (d * (numerator/denominator));
+        x += d * (numerator/denominator);
         
         //new d
-        d = ( (A*x) - b )* -1;
+        A.multiply(x, product);
+        d = b - product;
         
         count++;
         if(count > 5000) 
@@ -53,8 +77,6 @@ class SteepestDescent
           break;
         }
       }
-      
-      return x;
     }
     
 };
@@ -0,0 +1,206 @@
+/*
+  Filename:   StencilOperator.h
+  Author:     Raymond Hummel
+  Date:       5/12/2014
+  Purpose:    Contains the declaration of the StencilOperator class, a
+              matrix-free 5-point stencil for the Direchlet problem
+*/
+
+#ifndef STENCILOPERATOR_H
+#define STENCILOPERATOR_H
+
+#include "MatrixBase.h"
+
+
+/*
+The unknowns are the inner mesh points of an N division mesh, numbered
+one horizontal line at a time, so point (i,j) is row j*(N-1)+i. Each row
+has diagonal on the point itself and offDiagonal on its up, down, left
+and right neighbours that are inside the mesh, which is exactly the
+matrix that MatrixGenerator assembles.
+*/
+template<class T>
+class StencilOperator: public virtual MatrixBase<T>
+{
+  public:
+    /*  Description: Mesh Constructor, creates the Direchlet operator
+        Preconditions: N must be an integer greater than 1
+        Postconditions: diagonal = 1, offDiagonal = -1/N
+                        throws a SizeError if N < 2
+    */
+    StencilOperator(int N);
+    
+    
+    /*  Description: Coefficient Constructor, creates a stencil with the
+                     given coefficients
+        Preconditions: N must be an integer greater than 1
+        Postconditions: diagonal = diag, offDiagonal = off
+                        throws a SizeError if N < 2
+    */
+    StencilOperator(int N, const T& diag, const T& off);
+    
+    
+    /*  Description: Matrix Subscripting Operator, the operator is never
+                     stored so elements cannot be written
+        Preconditions: None
+        Postconditions: always throws
+    */
+    virtual T& operator()(int row, int col);
+    
+    
+    /*  Description: const Matrix Subscripting Operator, provides read-only
+                     access to elements of the matrix
+        Preconditions: row, col are positive integers between
+                       0 and numRows or numCols respectively
+        Postconditions: returns a const reference to the coefficient that
+                        couples row and col, or to zero
+                        throws a RangeError if row,col < 0 or row >= numRows
+                        or col >= numCols
+    */
+    virtual const T& operator()(int row, int col) const;
+    
+    
+    /*  Description: Matrix Addition, adds the coefficients of another stencil
+        Preconditions: rhs must be a StencilOperator
+        Postconditions: returns stencil with summed coefficients
+                        throws a SizeError if rhs has a different size
+    */
+    virtual MatrixBase<T>& operator+=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Matrix Subtraction, subtracts the coefficients of
+                     another stencil
+        Preconditions: rhs must be a StencilOperator
+        Postconditions: returns stencil with differenced coefficients
+                        throws a SizeError if rhs has a different size
+    */
+    virtual MatrixBase<T>& operator-=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Scalar Multiplication, multiplies both coefficients by
+                     the parameter value
+        Preconditions: T must have a defined multiplication operator
+        Postconditions: returns stencil with scaled coefficients
+    */
+    virtual MatrixBase<T>& operator*=(const T& rhs);
+    
+    
+    /*  Description: Matrix Multiplication, the product of two stencils is
+                     not a 5-point stencil
+        Preconditions: None
+        Postconditions: always throws
+    */
+    virtual MatrixBase<T>& operator*=(const MatrixBase<T>& rhs);
+    
+    
+    /*  Description: Vector Multiplication, applies the stencil to a vector
+                     straight from the mesh indices
+        Preconditions: T must have a defined multiplication operator
+                       T must have a defined addition operator
+        Postconditions: returns vector multiplication product with
+                        size = numRows x 1
+                        throws SizeError if numCol != rhs.numRows
+    */
+    virtual Vector<T> operator*(const Vector<T>& rhs) const;
+    
+    
+    /*  Description: Getter for the columns of calling object
+        Preconditions: None
+        Postconditions: returns the column referenced by colIndex
+    */
+    virtual Vector<T> getColumn(int colIndex) const;
+    
+    
+    /*  Description: Getter for the rows of calling object
+        Preconditions: None
+        Postconditions: returns the row referenced by rowIndex
+    */
+    virtual Vector<T> getRow(int rowIndex) const;
+    
+    
+    /*  Description: Getter for numRows
+        Preconditions: None
+        Postconditions: returns the number of rows in the matrix
+    */
+    virtual int getNumRows() const { return size; }
+    
+    
+    /*  Description: Getter for numCols
+        Preconditions: None
+        Postconditions: returns the number of columns in the matrix
+    */
+    virtual int getNumCols() const { return size; }
+    
+    
+    /*  Description: Determines if matrix is diagonally dominant
+        Preconditions: None
+        Postconditions: returns true if Aii > |Aij| for j!=i, else false
+    */
+    virtual bool isDiagonallyDominant() const;
+    
+    
+    /*  Description: Determines if matrix is symmetric
+        Preconditions: None
+        Postconditions: returns true, the stencil is symmetric
+    */
+    virtual bool symmetric() const { return true; }
+    
+    
+    /*  Description: Row Product, applies one row of the stencil to x
+        Preconditions: None
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
+    /*  Description: Row Nonzeros, lists the point and its neighbours
+        Preconditions: 0 <= rowIndex < numRows
+        Postconditions: columns and values hold the at most 5 elements of
+                        row rowIndex in column order
+                        throws RangeError if rowIndex is out of range
+    */
+    virtual void getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const;
+    
+    
+    /*  Description: Getter for N
+        Preconditions: None
+        Postconditions: returns the number of mesh divisions
+    */
+    int getN() const { return N; }
+    
+    
+    /*  Description: Getter for diagonal
+        Preconditions: None
+        Postconditions: returns the coefficient of the point itself
+    */
+    const T& getDiagonal() const { return diagonal; }
+    
+    
+    /*  Description: Getter for offDiagonal
+        Preconditions: None
+        Postconditions: returns the coefficient of the neighbours
+    */
+    const T& getOffDiagonal() const { return offDiagonal; }
+  
+  
+  private:
+    // number of mesh divisions, (N-1) points per line
+    int N;
+    int lineSize, size;
+    T diagonal, offDiagonal;
+    // referenced by const operator() for points that are not coupled
+    T zero;
+    
+    
+    /*  Description: Combine, adds scale times the coefficients of rhs
+        Preconditions: None
+        Postconditions: throws if rhs is not a StencilOperator of the
+                        same size
+    */
+    void combine(const MatrixBase<T>& rhs, const T& scale);
+
+};
+
+#include "StencilOperator.hpp"
+#endif
\ No newline at end of file
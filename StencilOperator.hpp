@@ -0,0 +1,174 @@
+/*
+  Filename:   StencilOperator.hpp
+  Author:     Raymond Hummel
+  Date:       5/12/2014
+  Purpose:    Contains the implementation of the StencilOperator class
+*/
+
+
+template<class T>
+StencilOperator<T>::StencilOperator(int N):N(N), zero(0)
+{
+  if(N < 2) throw SizeError(N, "StencilOperator(int N)");
+  lineSize = N-1;
+  size = lineSize*lineSize;
+  diagonal = 1;
+  offDiagonal = -1.0/N;
+}
+
+
+template<class T>
+StencilOperator<T>::StencilOperator(int N, const T& diag, const T& off)
+  :N(N), diagonal(diag), offDiagonal(off), zero(0)
+{
+  if(N < 2) throw SizeError(N, "StencilOperator(int N, diag, off)");
+  lineSize = N-1;
+  size = lineSize*lineSize;
+}
+
+
+template<class T>
+T& StencilOperator<T>::operator()(int, int)
+{
+  throw "StencilOperator elements cannot be written";
+}
+
+
+template<class T>
+const T& StencilOperator<T>::operator()(int row, int col) const
+{
+  if(row < 0 || row >= size) throw RangeError(row, "const operator() row");
+  if(col < 0 || col >= size) throw RangeError(col, "const operator() col");
+  if(row == col) return diagonal;
+  int distance = (row > col) ? row - col : col - row;
+  // up or down neighbour
+  if(distance == lineSize) return offDiagonal;
+  // left or right neighbour on the same line
+  if(distance == 1 && row/lineSize == col/lineSize) return offDiagonal;
+  return zero;
+}
+
+
+template<class T>
+MatrixBase<T>& StencilOperator<T>::operator+=(const MatrixBase<T>& rhs)
+{
+  combine(rhs, T(1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& StencilOperator<T>::operator-=(const MatrixBase<T>& rhs)
+{
+  combine(rhs, T(-1));
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& StencilOperator<T>::operator*=(const T& rhs)
+{
+  diagonal = diagonal * rhs;
+  offDiagonal = offDiagonal * rhs;
+  return *this;
+}
+
+
+template<class T>
+MatrixBase<T>& StencilOperator<T>::operator*=(const MatrixBase<T>&)
+{
+  throw "StencilOperator cannot be multiplied by a matrix";
+}
+
+
+template<class T>
+Vector<T> StencilOperator<T>::operator*(const Vector<T>& rhs) const
+{
+  if( size != rhs.getSize() ) throw SizeError(rhs.getSize(), "operator * vector");
+  Vector<T> retVal(size);
+  for(int row=0; row < size; row++)
+  {
+    retVal[row] = rowProduct(row, rhs);
+  }
+  return retVal;
+}
+
+
+template<class T>
+Vector<T> StencilOperator<T>::getColumn(int colIndex) const
+{
+  if(colIndex < 0 || colIndex >= size) throw RangeError(colIndex, "getColumn");
+  // the stencil is symmetric
+  return getRow(colIndex);
+}
+
+
+template<class T>
+Vector<T> StencilOperator<T>::getRow(int rowIndex) const
+{
+  if(rowIndex < 0 || rowIndex >= size) throw RangeError(rowIndex, "getRow");
+  int pos = rowIndex%lineSize;
+  Vector<T> row(size);
+  row = 0;
+  row[rowIndex] = diagonal;
+  if(rowIndex >= lineSize) row[rowIndex-lineSize] = offDiagonal;
+  if(pos != 0) row[rowIndex-1] = offDiagonal;
+  if(pos != lineSize-1) row[rowIndex+1] = offDiagonal;
+  if(rowIndex+lineSize < size) row[rowIndex+lineSize] = offDiagonal;
+  return row;
+}
+
+
+template<class T>
+bool StencilOperator<T>::isDiagonallyDominant() const
+{
+  // the most neighbours any point has, 4 on meshes with an inner point
+  int lineNeighbours = (lineSize > 2) ? 2 : lineSize-1;
+  T sum = abs(offDiagonal) * (2*lineNeighbours);
+  return !( sum > abs(diagonal) );
+}
+
+
+template<class T>
+T StencilOperator<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if( size != x.getSize() ) throw SizeError(x.getSize(), "rowProduct");
+  if(rowIndex < 0 || rowIndex >= size) throw RangeError(rowIndex, "rowProduct");
+  int pos = rowIndex%lineSize;
+  T neighbours = 0;
+  if(rowIndex >= lineSize) neighbours += x[rowIndex-lineSize];
+  if(pos != 0) neighbours += x[rowIndex-1];
+  if(pos != lineSize-1) neighbours += x[rowIndex+1];
+  if(rowIndex+lineSize < size) neighbours += x[rowIndex+lineSize];
+  return diagonal*x[rowIndex] + offDiagonal*neighbours;
+}
+
+
+template<class T>
+void StencilOperator<T>::getRowNonzeros(int rowIndex, vector<int>& columns, vector<T>& values) const
+{
+  if(rowIndex < 0 || rowIndex >= size) throw RangeError(rowIndex, "getRowNonzeros");
+  int pos = rowIndex%lineSize;
+  columns.clear();
+  values.clear();
+  if(rowIndex >= lineSize) columns.push_back(rowIndex-lineSize);
+  if(pos != 0) columns.push_back(rowIndex-1);
+  columns.push_back(rowIndex);
+  if(pos != lineSize-1) columns.push_back(rowIndex+1);
+  if(rowIndex+lineSize < size) columns.push_back(rowIndex+lineSize);
+  for(unsigned int k=0; k < columns.size(); k++)
+  {
+    values.push_back( (columns[k] == rowIndex) ? diagonal : offDiagonal );
+  }
+}
+
+
+template<class T>
+void StencilOperator<T>::combine(const MatrixBase<T>& rhs, const T& scale)
+{
+  const StencilOperator<T>* other = dynamic_cast<const StencilOperator<T>*>(&rhs);
+  if(!other) throw "StencilOperator can only be combined with a StencilOperator";
+  if(other->N != N) throw SizeError(other->N, "StencilOperator combine");
+  diagonal = diagonal + scale*other->diagonal;
+  offDiagonal = offDiagonal + scale*other->offDiagonal;
+}
\ No newline at end of file
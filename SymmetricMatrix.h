@@ -11,6 +11,7 @@
 
 #include "MatrixBase.h"
 #include "Matrix.h"
+#include "AlignedBuffer.h"
 
 
 // Forward Declarations
@@ -32,7 +33,7 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     /*  Description: Pre-Sized Constructor, creates SymmetricMatrix of size n by n
         Preconditions: n must be a positive, non-zero integer
                        T must have a defined default constructor
-        Postconditions: head points to an array of Vectors of size n,
+        Postconditions: head points to a packed buffer of n*(n+1)/2 elements,
                         numRows = n, numCols = n, throws a SizeError 
                         exception if n < 0
     */
@@ -46,6 +47,15 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     SymmetricMatrix(const SymmetricMatrix<T>& original);
     
     
+    /*  Description: Move Constructor, takes ownership of the elements 
+                     of the parameter instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of original,
+                        original is empty
+    */
+    SymmetricMatrix(SymmetricMatrix<T>&& original) noexcept;
+    
+    
     /*  Description: Destructor, frees dynamic memory
         Preconditions: None
         Postconditions: all dynamic memory associated with the calling 
@@ -62,7 +72,7 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
         Postconditions: returns a reference to the element of the MatrixBase 
                         specified by row, col
                         throws a RangeError if row,col < 0 or row >= numRows 
-                        or col >= numCols
+                        or col >= numCols and BOUNDS_CHECK is on
     */
     virtual T& operator()(int row, int col);
     
@@ -74,11 +84,30 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
         Postconditions: returns a const reference to the element of the MatrixBase
                         specified by row, col
                         throws a RangeError if row,col < 0 or row >= numRows 
-                        or col >= numCols
+                        or col >= numCols and BOUNDS_CHECK is on
     */
     virtual const T& operator()(int row, int col) const;
     
     
+    /*  Description: Raw Access, provides the packed upper triangle for
+                     kernels that loop over it directly
+        Preconditions: None
+        Postconditions: returns a pointer to the numRows*(numRows+1)/2
+                        stored elements, row i holds (i,i) through
+                        (i,numCols-1) and starts at
+                        [i*numCols - i*(i-1)/2]
+    */
+    T* data() { return head; }
+    
+    
+    /*  Description: const Raw Access, provides read-only access to the
+                     packed upper triangle
+        Preconditions: None
+        Postconditions: returns a pointer to the stored elements
+    */
+    const T* data() const { return head; }
+    
+    
     /*  Description: Copy Assignment Operator, supports operator chaining 
                      and self-assignment
         Preconditions: T must have a defined copy assignment operator
@@ -89,6 +118,16 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     SymmetricMatrix<T>& operator=(const SymmetricMatrix<T>& rhs);
     
     
+    /*  Description: Move Assignment Operator, takes ownership of the
+                     elements of rhs instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of rhs, the 
+                        previous elements are freed, rhs is empty
+                        returns a reference to the calling object
+    */
+    SymmetricMatrix<T>& operator=(SymmetricMatrix<T>&& rhs) noexcept;
+    
+    
     /*  Description: SymmetricMatrix Addition, adds matrices
         Preconditions: T must have a defined addition operator
                        T must have a defined copy assignment operator
@@ -187,6 +226,22 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     virtual bool isDiagonallyDominant() const { return Matrix<T>::isDiagonallyDominant(); }
     
     
+    /*  Description: Determines if matrix is symmetric
+        Preconditions: None
+        Postconditions: returns true, storage only holds the upper triangle
+    */
+    virtual bool symmetric() const { return true; }
+    
+    
+    /*  Description: Row Product, multiplies a single row of the matrix by
+                     a vector without building the row
+        Preconditions: None
+        Postconditions: returns the dot product of row rowIndex and x
+                        throws SizeError if numCols != x.size
+    */
+    virtual T rowProduct(int rowIndex, const Vector<T>& x) const;
+    
+    
     /*  Description: Setter for size
         Preconditions: row, col must be positive non-zero integers
                        T must have a defined default constructor
@@ -197,6 +252,15 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     void setSize(int rows, int cols);
     
     
+    /*  Description: Swap, exchanges the elements of two matrices without
+                     copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of other and
+                        vice versa
+    */
+    void swap(SymmetricMatrix<T>& other) noexcept;
+    
+    
     /*  Description: Determine if given matrix is symmetric
         Preconditions: None
         Postconditions: returns true iff matrix is symmetric, else false
@@ -208,7 +272,22 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
     
   private:
     int numRows, numCols;
-    Vector<T>* head;
+    // one cache-line aligned buffer holding the upper triangle row by row
+    T* head;
+    
+    /*  Description: Packed Index, locates an element of the upper triangle
+        Preconditions: 0 <= row <= col < numCols
+        Postconditions: returns the position of row, col in head, in
+                        size_t since it passes the int range long before
+                        the rows do
+    */
+    size_t index(int row, int col) const { return size_t(row)*(2*size_t(numCols) - row + 1)/2 + col-row; }
+    
+    /*  Description: Getter for the number of stored elements
+        Preconditions: None
+        Postconditions: returns numRows*(numRows+1)/2
+    */
+    size_t storedSize() const { return size_t(numRows)*(numRows+1)/2; }
     
     /*  Description: copy function, creates deep copy of elements in a
         Preconditions: T must have a defined copy assignment operator
@@ -219,5 +298,14 @@ class SymmetricMatrix:public virtual MatrixBase<T>, private Matrix<T>
 };
 
 
+/*  Description: Swap, exchanges the elements of two matrices without
+                 copying them
+    Preconditions: None
+    Postconditions: a holds the elements of b and vice versa
+*/
+template<class T>
+void swap(SymmetricMatrix<T>& a, SymmetricMatrix<T>& b) noexcept { a.swap(b); }
+
+
 #include "SymmetricMatrix.hpp"
 #endif
\ No newline at end of file
@@ -12,11 +12,7 @@ SymmetricMatrix<T>::SymmetricMatrix(const int& n)
   if( n < 0 ) throw SizeError(n, "size constructor");
   numRows = n;
   numCols = n;
-  head = new Vector<T>[numRows];
-  for(int i=0; i<numCols; i++)
-  {
-    head[i].setSize(numCols-i);
-  }
+  head = alignedNew<T>(storedSize());
 }
 
 
@@ -25,49 +21,59 @@ SymmetricMatrix<T>::SymmetricMatrix(const SymmetricMatrix<T>& original):Matrix<T
 {
   numRows = original.numRows;
   numCols = original.numCols;
-  head = new Vector<T>[numRows];
-  for(int i=0; i < numRows; i++)
-  {
-    head[i].setSize(numCols-i);
-  }
+  head = alignedNew<T>(storedSize());
   copy(original);
 }
 
 
+template<class T>
+SymmetricMatrix<T>::SymmetricMatrix(SymmetricMatrix<T>&& original) noexcept
+  :Matrix<T>(), numRows(original.numRows), numCols(original.numCols), head(original.head)
+{
+  original.numRows = 0;
+  original.numCols = 0;
+  original.head = 0;
+}
+
+
 template<class T>
 SymmetricMatrix<T>::~SymmetricMatrix()
 {
-  delete [] head;
+  alignedDelete(head, storedSize());
 }
 
 
 template<class T>
 T& SymmetricMatrix<T>::operator()(int row, int col)
 {
+#if BOUNDS_CHECK
   if(row < 0 || row >= numRows) throw RangeError(row, "operator() row");
   if(col < 0 || col >= numCols) throw RangeError(col, "operator() col");
+#endif
   if(row > col) // swap row and col if on wrong side of matrix
   {
     int temp = row;
     row = col;
     col = temp;
   }
-  return head[row][col-row];
+  return head[index(row,col)];
 }
 
 
 template<class T>
 const T& SymmetricMatrix<T>::operator()(int row, int col) const
 {
+#if BOUNDS_CHECK
   if(row < 0 || row >= numRows) throw RangeError(row, "const operator() row");
   if(col < 0 || col >= numCols) throw RangeError(col, "const operator() con");
+#endif
   if(row > col) // swap row and col if on wrong side of matrix
   {
     int temp = row;
     row = col;
     col = temp;
   }
-  return head[row][col-row];
+  return head[index(row,col)];
 }
 
 
@@ -83,6 +89,23 @@ SymmetricMatrix<T>& SymmetricMatrix<T>::operator=(const SymmetricMatrix<T>& rhs)
 }
 
 
+template<class T>
+SymmetricMatrix<T>& SymmetricMatrix<T>::operator=(SymmetricMatrix<T>&& rhs) noexcept
+{
+  if( this != &rhs )
+  {
+    alignedDelete(head, storedSize());
+    numRows = rhs.numRows;
+    numCols = rhs.numCols;
+    head = rhs.head;
+    rhs.numRows = 0;
+    rhs.numCols = 0;
+    rhs.head = 0;
+  }
+  return *this;
+}
+
+
 template<class T>
 MatrixBase<T>& SymmetricMatrix<T>::operator+=(const MatrixBase<T>& rhs)
 {
@@ -120,9 +143,9 @@ MatrixBase<T>& SymmetricMatrix<T>::operator-=(const MatrixBase<T>& rhs)
 template<class T>
 MatrixBase<T>& SymmetricMatrix<T>::operator*=(const T& rhs)
 {
-  for(int i=0; i < numRows; i++)
+  for(size_t k=0; k < storedSize(); k++)
   {
-    head[i] = head[i] * rhs;
+    head[k] = head[k] * rhs;
   }
   return *this;
 }
@@ -141,7 +164,7 @@ MatrixBase<T>& SymmetricMatrix<T>::operator*=(const MatrixBase<T>& rhs)
       temp(i,j) = getRow(i) * rhs.getColumn(j);//TODO: check that this all makes sense
     }
   }
-  *this = temp;
+  swap(temp);
   return *this;
 }
 
@@ -153,7 +176,28 @@ Vector<T> SymmetricMatrix<T>::operator*(const Vector<T>& rhs) const
   Vector<T> retVal(numRows);
   for(int i=0; i < numRows; i++)
   {
-    retVal[i] = head[i] * rhs;
+    retVal[i] = rowProduct(i, rhs);
+  }
+  return retVal;
+}
+
+
+template<class T>
+T SymmetricMatrix<T>::rowProduct(int rowIndex, const Vector<T>& x) const
+{
+  if( numCols != x.getSize() ) throw SizeError(x.getSize(), "rowProduct");
+  if(rowIndex < 0 || rowIndex >= numRows) throw RangeError(rowIndex, "rowProduct");
+  T retVal = 0;
+  // lower triangle is stored as column rowIndex of the rows above
+  for(int j=0; j < rowIndex; j++)
+  {
+    retVal += head[index(j,rowIndex)] * x[j];
+  }
+  // upper triangle of the row is contiguous
+  const T* row = head + index(rowIndex,rowIndex);
+  for(int j=rowIndex; j < numCols; j++)
+  {
+    retVal += row[j-rowIndex] * x[j];
   }
   return retVal;
 }
@@ -207,40 +251,43 @@ void SymmetricMatrix<T>::setSize(int rows, int cols)
     if(rows < 0) throw SizeError(rows, "setSize row");
     if(cols < 0) throw SizeError(cols, "setSize col");
     if(rows != cols) throw SizeError(cols, "setSize square");
-    delete [] head;
+    alignedDelete(head, storedSize());
     numRows = rows;
     numCols = cols;
-    head = new Vector<T>[numRows];
-    for(int i=0; i<numRows; i++)
-    {
-      head[i].setSize(numCols);
-    }
+    head = alignedNew<T>(storedSize());
   }
 }
 
 
+template<class T>
+void SymmetricMatrix<T>::swap(SymmetricMatrix<T>& other) noexcept
+{
+  int tempRows = numRows;
+  int tempCols = numCols;
+  T* tempHead = head;
+  numRows = other.numRows;
+  numCols = other.numCols;
+  head = other.head;
+  other.numRows = tempRows;
+  other.numCols = tempCols;
+  other.head = tempHead;
+}
+
+
 template<class T> 
 bool isSymmetric(const MatrixBase<T>& matrix)
 {
-  if(matrix.getNumRows() != matrix.getNumCols()) return false;
-  
-  for(int i=0; i < matrix.getNumRows(); i++)
-  {
-    for(int j=0; j <= i; j++)
-    {
-      if(matrix(i,j) != matrix(j,i)) return false;
-    }
-  }
-  return true;
+  return matrix.symmetric();
 }
 
 
 template<class T>
 void SymmetricMatrix<T>::copy(const SymmetricMatrix<T>& a)
 {
-  for(int i=0; i < numRows; i++)
+  if(a.numRows != numRows) throw SizeError(a.numRows, "copy");
+  for(size_t k=0; k < storedSize(); k++)
   {
-    head[i] = a.head[i]; // copy assign throws SizeError
+    head[k] = a.head[k];
   }
 }
 
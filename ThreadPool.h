@@ -0,0 +1,173 @@
+/*
+  Filename:   ThreadPool.h
+  Author:     Raymond Hummel
+  Date:       5/21/2014
+  Purpose:    Contains the definition and implementation of the ThreadPool
+              class
+*/
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+using namespace std;
+
+
+/*
+A ThreadPool keeps its worker threads alive between jobs so a solver can
+hand out one job per sweep without paying for thread creation each time.
+The workers are started by the first job, so a solver that owns a pool
+costs no threads until it is used.
+A job is a numbered set of tasks, run blocks until every task has finished
+and the calling thread works on the tasks too, so a pool of n threads
+starts only n-1 workers.
+*/
+class ThreadPool
+{
+  public:
+    /*  Description: Constructor, sets the number of threads
+        Preconditions: None
+        Postconditions: the pool runs tasks on numThreads threads, the
+                        caller included, numThreads < 1 uses one thread
+                        per hardware core, no worker is started yet
+    */
+    ThreadPool(int numThreads = 0)
+      :numThreads(numThreads), job(NULL), numTasks(0), nextTask(0), unfinished(0),
+       generation(0), stopping(false)
+    {
+      if(this->numThreads < 1) this->numThreads = thread::hardware_concurrency();
+      if(this->numThreads < 1) this->numThreads = 1;
+    }
+    
+    
+    /*  Description: Destructor, stops the worker threads
+        Preconditions: no job is running
+        Postconditions: every worker has been joined
+    */
+    ~ThreadPool()
+    {
+      {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+      }
+      started.notify_all();
+      for(unsigned int i=0; i < workers.size(); i++)
+      {
+        workers[i].join();
+      }
+    }
+    
+    
+    /*  Description: Run, calls task(0) through task(count-1) across the
+                     pool
+        Preconditions: tasks may run in any order and at the same time
+        Postconditions: every task has returned, the workers have been
+                        started
+    */
+    void run(int count, const function<void(int)>& task)
+    {
+      if(count <= 0) return;
+      if(workers.empty())
+      {
+        for(int i=1; i < numThreads; i++)
+        {
+          workers.push_back(thread(&ThreadPool::work, this));
+        }
+      }
+      {
+        lock_guard<mutex> guard(lock);
+        job = &task;
+        numTasks = count;
+        nextTask = 0;
+        unfinished = count;
+        generation++;
+      }
+      started.notify_all();
+      runTasks();
+      unique_lock<mutex> guard(lock);
+      while(unfinished > 0) finished.wait(guard);
+      job = NULL;
+    }
+    
+    
+    /*  Description: Getter for the number of threads
+        Preconditions: None
+        Postconditions: returns the threads that run tasks, the caller
+                        included
+    */
+    int getNumThreads() const { return numThreads; }
+  
+  
+  private:
+    int numThreads;
+    vector<thread> workers;
+    mutex lock;
+    condition_variable started, finished;
+    const function<void(int)>* job;
+    int numTasks, nextTask, unfinished;
+    // counts jobs so a worker never runs the same job twice
+    long generation;
+    bool stopping;
+    
+    
+    /*  Description: Copy Constructor, a pool owns its threads
+        Preconditions: never called
+        Postconditions: None
+    */
+    ThreadPool(const ThreadPool&);
+    
+    
+    /*  Description: Assignment Operator, a pool owns its threads
+        Preconditions: never called
+        Postconditions: None
+    */
+    ThreadPool& operator=(const ThreadPool&);
+    
+    
+    /*  Description: Work, the loop of a worker thread
+        Preconditions: None
+        Postconditions: returns once the pool is stopping
+    */
+    void work()
+    {
+      long seen = 0;
+      while(true)
+      {
+        {
+          unique_lock<mutex> guard(lock);
+          while(!stopping && generation == seen) started.wait(guard);
+          if(stopping) return;
+          seen = generation;
+        }
+        runTasks();
+      }
+    }
+    
+    
+    /*  Description: Run Tasks, claims and runs tasks of the current job
+                     until none are left
+        Preconditions: None
+        Postconditions: every task this thread claimed has finished
+    */
+    void runTasks()
+    {
+      unique_lock<mutex> guard(lock);
+      while(job != NULL && nextTask < numTasks)
+      {
+        int task = nextTask++;
+        const function<void(int)>& current = *job;
+        guard.unlock();
+        current(task);
+        guard.lock();
+        if(--unfinished == 0) finished.notify_all();
+      }
+    }
+
+};
+
+#endif
\ No newline at end of file
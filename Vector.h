@@ -14,7 +14,9 @@
 #include <iostream>
 #include <cstdlib>
 #include <cmath>
+#include <atomic>
 
+#include "VectorExpression.h"
 
 using namespace std;
 
@@ -29,8 +31,13 @@ template<class T>
 ifstream& operator>>( ifstream& input, Vector<T>& vector);
 
 
+/*
+The arithmetic operators +, - and * (by a scalar) are defined in 
+VectorExpression.h, they build expressions that are evaluated in a single
+loop when assigned to a Vector. The dot product is defined there as well.
+*/
 template<class T>
-class Vector
+class Vector: public VectorExpression<T, Vector<T> >
 {
   public:
     /*  Description: Pre-Sized Constructor, creates Vector of size n
@@ -56,6 +63,24 @@ class Vector
     Vector(const Vector<T>& original);
     
     
+    /*  Description: Move Constructor, takes ownership of the elements 
+                     of the parameter instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of original,
+                        original is empty
+    */
+    Vector(Vector<T>&& original) noexcept;
+    
+    
+    /*  Description: Expression Constructor, evaluates a vector expression
+                     in a single pass
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: calling object holds every element of expression
+    */
+    template<class E>
+    Vector(const VectorExpression<T,E>& expression);
+    
+    
     /*  Description: Destructor, frees dynamic memory
         Preconditions: None
         Postconditions: all dynamic memory associated with the calling 
@@ -69,7 +94,8 @@ class Vector
         Preconditions: i is a positive integer between 0 and size-1
                        calling object is not const
         Postconditions: returns a reference to the ith member of the Vector
-                        throws a RangeError if i < 0 or i >= size
+                        throws a RangeError if i < 0 or i >= size and
+                        BOUNDS_CHECK is on
     */
     T& operator[](int i);
     
@@ -78,11 +104,30 @@ class Vector
                      elements of the vector
         Preconditions: i is a positive integer between 0 and size-1
         Postconditions: returns a const reference to the ith member of the Vector
-                        throws a RangeError if i < 0 or i >= size
+                        throws a RangeError if i < 0 or i >= size and
+                        BOUNDS_CHECK is on
     */
     const T& operator[](int i) const;
     
     
+    /*  Description: Raw Access, provides the element array for kernels
+                     that loop over it directly
+        Preconditions: None
+        Postconditions: returns a pointer to the size contiguous elements,
+                        it is invalidated by setSize, swap and assignment
+                        from a vector of a different size
+    */
+    T* data() { return head; }
+    
+    
+    /*  Description: const Raw Access, provides read-only access to the
+                     element array
+        Preconditions: None
+        Postconditions: returns a pointer to the size contiguous elements
+    */
+    const T* data() const { return head; }
+    
+    
     /*  Description: Copy Assignment Operator, supports operator chaining 
                      and self-assignment
         Preconditions: T must have a defined copy assignment operator
@@ -93,6 +138,27 @@ class Vector
     Vector<T>& operator=(const Vector<T>& rhs);
     
     
+    /*  Description: Move Assignment Operator, takes ownership of the
+                     elements of rhs instead of copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of rhs, the 
+                        previous elements are freed, rhs is empty
+                        returns a reference to the calling object
+    */
+    Vector<T>& operator=(Vector<T>&& rhs) noexcept;
+    
+    
+    /*  Description: Expression Assignment Operator, evaluates a vector
+                     expression in a single pass with no temporaries,
+                     the expression may refer to the calling object
+        Preconditions: T must have a defined copy assignment operator
+        Postconditions: calling object holds every element of rhs
+                        returns a reference to the calling object
+    */
+    template<class E>
+    Vector<T>& operator=(const VectorExpression<T,E>& rhs);
+    
+    
     /*  Description: Scalar Assignment Operator, initializes all elements 
                      of the Vector to a parameter value
         Preconditions: T must have a defined copy assignment operator
@@ -102,16 +168,6 @@ class Vector
     Vector<T>& operator=(const T& rhs);
     
     
-    /*  Description: Scalar Multiplication Operator, multiplies all elements 
-                     of the Vector by the parameter value
-        Preconditions: T must have a defined multiplication operator
-                       T must have a defined copy assignment operator
-        Postconditions: returns vector with every element containing 
-                        calling object's element multiplied by rhs
-    */
-    Vector<T> operator*(const T& rhs) const;
-    
-    
     /*  Description: Scalar Multiplication and Assignment Operator, multiplies
                      all elements of the Vector by the parameter value
         Preconditions: T must have a defined multiplication operator
@@ -122,47 +178,29 @@ class Vector
     Vector<T>& operator*=(const T& rhs);
     
     
-    /*  Description: Dot Product, multiplies all elements 
-                     of the Vector by the parameter value
-        Preconditions: T must have a defined multiplication operator
-                       T must have a defined copy assignment operator
-                       T must be able to convert ints
-        Postconditions: returns the sum of an elementwise multiplication
-    */
-    T operator*(const Vector<T>& rhs) const;
-    
-    
-    /*  Description: Vector Addition Operator, adds all elements
-                     of the two vectors
-        Preconditions: T must have a defined addition operator
-                       T must have a defined copy assignment operator
-        Postconditions: throws SizeError if vectors are not same size
-                        returns vector with element-wise addition of rhs
-                        and the calling object
-    */
-    Vector<T> operator+(const Vector<T>& rhs) const;
-    
-    
     /*  Description: Vector Addition and Assignment Operator, adds all elements
-                     of parameter vector to the calling vector
+                     of parameter vector or expression to the calling vector
         Preconditions: T must have a defined addition operator
                        T must have a defined copy assignment operator
         Postconditions: throws SizeError if vectors are not same size
                         callingObject[i] += rhs[i]
                         returns a reference to the calling object
     */
-    Vector<T>& operator+=(const Vector<T>& rhs);
+    template<class E>
+    Vector<T>& operator+=(const VectorExpression<T,E>& rhs);
     
     
-    /*  Description: Vector Subtraction Operator, subtracts all elements
-                     of the two vectors
+    /*  Description: Vector Subtraction and Assignment Operator, subtracts all 
+                     elements of parameter vector or expression from the 
+                     calling vector
         Preconditions: T must have a defined subtraction operator
                        T must have a defined copy assignment operator
         Postconditions: throws SizeError if vectors are not same size
-                        returns vector with element-wise difference of rhs
-                        and the calling object
+                        callingObject[i] -= rhs[i]
+                        returns a reference to the calling object
     */
-    Vector<T> operator-(const Vector<T>& rhs) const;
+    template<class E>
+    Vector<T>& operator-=(const VectorExpression<T,E>& rhs);
     
     
     /*  Description: Vector Sum, adds all elements of the vector together
@@ -190,6 +228,25 @@ class Vector
     void setSize(int n);
     
     
+    /*  Description: Swap, exchanges the elements of two vectors without
+                     copying them
+        Preconditions: None
+        Postconditions: calling object holds the elements of other and
+                        vice versa
+    */
+    void swap(Vector<T>& other) noexcept;
+    
+    
+    /*  Description: Getter for the allocation counter
+        Preconditions: None
+        Postconditions: returns the number of element arrays every
+                        Vector<T> has allocated since the program started,
+                        comparing two readings shows whether the code in
+                        between touched the heap for vector storage
+    */
+    static long getAllocationCount() { return allocationCount; }
+    
+    
     /*  Description: Extraction operator
         Preconditions: None
         Postconditions: elements of vector are streamed to output, 
@@ -220,6 +277,15 @@ class Vector
     int size;
     // pointer to dynamically allocated array
     T* head;
+    // number of arrays allocated by all Vector<T>, see getAllocationCount
+    static atomic<long> allocationCount;
+    
+    /*  Description: allocate function, the only place element arrays are
+                     created so that they are all counted
+        Preconditions: n >= 0
+        Postconditions: returns an array of n elements from new[]
+    */
+    static T* allocate(int n);
     
     /*  Description: copy function, creates deep copy of elements in a
         Preconditions: T must have a defined copy assignment operator
@@ -229,5 +295,14 @@ class Vector
 };
 
 
+/*  Description: Swap, exchanges the elements of two vectors without
+                 copying them
+    Preconditions: None
+    Postconditions: a holds the elements of b and vice versa
+*/
+template<class T>
+void swap(Vector<T>& a, Vector<T>& b) noexcept { a.swap(b); }
+
+
 #include "Vector.hpp"
 #endif
\ No newline at end of file
@@ -11,12 +11,16 @@
 
 using namespace std;
 
+template<class T>
+atomic<long> Vector<T>::allocationCount(0);
+
+
 template<class T>
 Vector<T>::Vector(int n)
 {
   if(n < 0) throw SizeError(n, "Vector(int n)");
   size = n;
-  head = new T[n];
+  head = allocate(n);
 }
 
 
@@ -32,11 +36,35 @@ template<class T>
 Vector<T>::Vector(const Vector<T>& original)
 {
   size = original.size;
-  head = new T[size];
+  head = allocate(size);
   copy(original);
 }
 
 
+template<class T>
+Vector<T>::Vector(Vector<T>&& original) noexcept
+{
+  size = original.size;
+  head = original.head;
+  original.size = 0;
+  original.head = 0;
+}
+
+
+template<class T>
+template<class E>
+Vector<T>::Vector(const VectorExpression<T,E>& expression)
+{
+  const E& source = static_cast<const E&>(expression);
+  size = source.getSize();
+  head = allocate(size);
+  for(int i=0; i < size; i++)
+  {
+    head[i] = source[i];
+  }
+}
+
+
 template<class T>
 Vector<T>::~Vector()
 {
@@ -47,7 +75,9 @@ Vector<T>::~Vector()
 template<class T>
 T& Vector<T>::operator[](int i)
 {
+#if BOUNDS_CHECK
   if(i < 0 || i >= size) throw RangeError(i, "operator[]");
+#endif
   return head[i];
 }
 
@@ -55,7 +85,9 @@ T& Vector<T>::operator[](int i)
 template<class T>
 const T& Vector<T>::operator[](int i) const
 {
+#if BOUNDS_CHECK
   if(i < 0 || i >= size) throw RangeError(i, "const operator[]");
+#endif
   return head[i];
 }
 
@@ -73,79 +105,80 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& rhs)
 
 
 template<class T>
-Vector<T>& Vector<T>::operator=(const T& rhs)
+Vector<T>& Vector<T>::operator=(Vector<T>&& rhs) noexcept
 {
-  T* p = head + size;
-  while(p > head) *--p = rhs;
+  if(this != &rhs)
+  {
+    delete [] head;
+    size = rhs.size;
+    head = rhs.head;
+    rhs.size = 0;
+    rhs.head = 0;
+  }
   return *this;
 }
 
 
 template<class T>
-Vector<T> Vector<T>::operator*(const T& rhs) const
-{
-  Vector<T> retVal(*this);
-  retVal *= rhs;
-  return retVal;
-}
-
-
-template<class T>
-Vector<T>& Vector<T>::operator*=(const T& rhs)
+template<class E>
+Vector<T>& Vector<T>::operator=(const VectorExpression<T,E>& rhs)
 {
+  const E& source = static_cast<const E&>(rhs);
+  // a different size means the expression cannot refer to the calling object
+  setSize(source.getSize());
   for(int i=0; i < size; i++)
   {
-    head[i] = head[i] * rhs;
+    head[i] = source[i];
   }
   return *this;
 }
 
 
 template<class T>
-T Vector<T>::operator*(const Vector<T>& rhs) const
+Vector<T>& Vector<T>::operator=(const T& rhs)
 {
-  if(size != rhs.size) throw SizeError(rhs.size, "operator*(Vector)");
-  T retVal = 0;
-  for(int i=0; i < size; i++)
-  {
-    retVal += head[i] * rhs[i];
-  }
-  return retVal;
+  T* p = head + size;
+  while(p > head) *--p = rhs;
+  return *this;
 }
 
 
 template<class T>
-Vector<T> Vector<T>::operator+(const Vector<T>& rhs) const
+Vector<T>& Vector<T>::operator*=(const T& rhs)
 {
-  if(size != rhs.size) throw SizeError(rhs.size, "operator+");
-  Vector<T> retVal(*this);
-  retVal += rhs;
-  return retVal;
+  for(int i=0; i < size; i++)
+  {
+    head[i] = head[i] * rhs;
+  }
+  return *this;
 }
 
 
 template<class T>
-Vector<T>& Vector<T>::operator+=(const Vector<T>& rhs)
+template<class E>
+Vector<T>& Vector<T>::operator+=(const VectorExpression<T,E>& rhs)
 {
-  if(size != rhs.size) throw SizeError(rhs.size, "operator+=");
+  const E& expression = static_cast<const E&>(rhs);
+  if(size != expression.getSize()) throw SizeError(expression.getSize(), "operator+=");
   for(int i=0; i < size; i++)
   {
-    head[i] = head[i] + rhs[i];
+    head[i] = head[i] + expression[i];
   }
   return *this;
 }
 
 
 template<class T>
-Vector<T> Vector<T>::operator-(const Vector<T>& rhs) const
+template<class E>
+Vector<T>& Vector<T>::operator-=(const VectorExpression<T,E>& rhs)
 {
-  if(size != rhs.size) throw SizeError(rhs.size, "operator-");
-  Vector<T> retVal(size);
+  const E& expression = static_cast<const E&>(rhs);
+  if(size != expression.getSize()) throw SizeError(expression.getSize(), "operator-=");
   for(int i=0; i < size; i++)
   {
-    retVal[i] = head[i] - rhs[i];
+    head[i] = head[i] - expression[i];
   }
-  return retVal;
+  return *this;
 }
 
 
@@ -176,7 +209,7 @@ void Vector<T>::setSize(int n)
     if(n < 0) throw SizeError(n, "setSize");
     delete [] head;
     size = n;
-    head = new T[n];
+    head = allocate(n);
     for(int i=0; i < 0; i++)
     {
       head[i] = 0;
@@ -185,6 +218,18 @@ void Vector<T>::setSize(int n)
 }
 
 
+template<class T>
+void Vector<T>::swap(Vector<T>& other) noexcept
+{
+  int tempSize = size;
+  T* tempHead = head;
+  size = other.size;
+  head = other.head;
+  other.size = tempSize;
+  other.head = tempHead;
+}
+
+
 // Copies the elements of a into *this
 template<class T>
 void Vector<T>::copy(const Vector<T>& a)
@@ -243,3 +288,9 @@ ifstream& operator>>( ifstream& input, Vector<T>& vector)
 }
 
 
+template<class T>
+T* Vector<T>::allocate(int n)
+{
+  allocationCount++;
+  return new T[n];
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*
+  Filename:   VectorExpression.h
+  Author:     Raymond Hummel
+  Date:       5/15/2014
+  Purpose:    Contains the declaration and implementation of the expression
+              templates used for Vector arithmetic
+*/
+
+/*
+Vector sums, differences and scalar multiples do not compute anything when
+they are written, they return a small object that remembers its operands.
+The work happens when the expression is assigned to (or used to construct)
+a Vector, so an expression like x = x + d*alpha runs as one loop over the
+elements with no temporary Vectors. Operands are held by reference, so an
+expression must be used within the statement that creates it.
+*/
+
+
+#ifndef VECTOREXPRESSION_H
+#define VECTOREXPRESSION_H
+
+#include "Error.h"
+
+
+template<class T, class E>
+class VectorExpression
+{
+  public:
+    typedef T value_type;
+    
+    
+    /*  Description: Element Evaluation, computes one element of the
+                     expression
+        Preconditions: i is a positive integer between 0 and size-1
+        Postconditions: returns the ith element of the expression
+    */
+    T operator[](int i) const { return static_cast<const E&>(*this)[i]; }
+    
+    
+    /*  Description: Getter for size
+        Preconditions: None
+        Postconditions: returns the size of the expression
+    */
+    int getSize() const { return static_cast<const E&>(*this).getSize(); }
+};
+
+
+template<class T, class L, class R>
+class VectorSum: public VectorExpression<T, VectorSum<T,L,R> >
+{
+  public:
+    /*  Description: Constructor, remembers both operands
+        Preconditions: None
+        Postconditions: throws SizeError if operands are not the same size
+    */
+    VectorSum(const L& left, const R& right):lhs(left), rhs(right)
+    {
+      if(lhs.getSize() != rhs.getSize()) throw SizeError(rhs.getSize(), "operator+");
+    }
+    
+    T operator[](int i) const { return lhs[i] + rhs[i]; }
+    int getSize() const { return lhs.getSize(); }
+  
+  private:
+    const L& lhs;
+    const R& rhs;
+};
+
+
+template<class T, class L, class R>
+class VectorDifference: public VectorExpression<T, VectorDifference<T,L,R> >
+{
+  public:
+    /*  Description: Constructor, remembers both operands
+        Preconditions: None
+        Postconditions: throws SizeError if operands are not the same size
+    */
+    VectorDifference(const L& left, const R& right):lhs(left), rhs(right)
+    {
+      if(lhs.getSize() != rhs.getSize()) throw SizeError(rhs.getSize(), "operator-");
+    }
+    
+    T operator[](int i) const { return lhs[i] - rhs[i]; }
+    int getSize() const { return lhs.getSize(); }
+  
+  private:
+    const L& lhs;
+    const R& rhs;
+};
+
+
+template<class T, class E>
+class VectorScaled: public VectorExpression<T, VectorScaled<T,E> >
+{
+  public:
+    /*  Description: Constructor, remembers the operand and the scalar
+        Preconditions: None
+        Postconditions: None
+    */
+    VectorScaled(const E& operand, const T& scalar):vect(operand), factor(scalar) {}
+    
+    T operator[](int i) const { return vect[i] * factor; }
+    int getSize() const { return vect.getSize(); }
+  
+  private:
+    const E& vect;
+    T factor;
+};
+
+
+/*  Description: Vector Addition Operator, adds all elements
+                 of the two vectors
+    Preconditions: T must have a defined addition operator
+    Postconditions: throws SizeError if vectors are not same size
+                    returns expression for the element-wise addition
+*/
+template<class T, class L, class R>
+VectorSum<T,L,R> operator+(const VectorExpression<T,L>& lhs, const VectorExpression<T,R>& rhs)
+{
+  return VectorSum<T,L,R>(static_cast<const L&>(lhs), static_cast<const R&>(rhs));
+}
+
+
+/*  Description: Vector Subtraction Operator, subtracts all elements
+                 of the two vectors
+    Preconditions: T must have a defined subtraction operator
+    Postconditions: throws SizeError if vectors are not same size
+                    returns expression for the element-wise difference
+*/
+template<class T, class L, class R>
+VectorDifference<T,L,R> operator-(const VectorExpression<T,L>& lhs, const VectorExpression<T,R>& rhs)
+{
+  return VectorDifference<T,L,R>(static_cast<const L&>(lhs), static_cast<const R&>(rhs));
+}
+
+
+/*  Description: Scalar Multiplication Operator, multiplies all elements
+                 of the vector by the parameter value
+    Preconditions: T must have a defined multiplication operator
+    Postconditions: returns expression for every element multiplied by rhs
+*/
+template<class T, class E>
+VectorScaled<T,E> operator*(const VectorExpression<T,E>& lhs, const typename VectorExpression<T,E>::value_type& rhs)
+{
+  return VectorScaled<T,E>(static_cast<const E&>(lhs), rhs);
+}
+
+
+/*  Description: Scalar Multiplication Operator, multiplies all elements
+                 of the vector by the parameter value
+    Preconditions: T must have a defined multiplication operator
+    Postconditions: returns expression for every element multiplied by lhs
+*/
+template<class T, class E>
+VectorScaled<T,E> operator*(const typename VectorExpression<T,E>::value_type& lhs, const VectorExpression<T,E>& rhs)
+{
+  return VectorScaled<T,E>(static_cast<const E&>(rhs), lhs);
+}
+
+
+/*  Description: Dot Product, multiplies the vectors element-wise and adds
+                 the products in a single pass
+    Preconditions: T must have a defined multiplication operator
+                   T must be able to convert ints
+    Postconditions: returns the sum of an elementwise multiplication
+                    throws SizeError if vectors are not same size
+*/
+template<class T, class L, class R>
+T operator*(const VectorExpression<T,L>& lhs, const VectorExpression<T,R>& rhs)
+{
+  const L& left = static_cast<const L&>(lhs);
+  const R& right = static_cast<const R&>(rhs);
+  if(left.getSize() != right.getSize()) throw SizeError(right.getSize(), "operator*(Vector)");
+  T retVal = 0;
+  for(int i=0; i < left.getSize(); i++)
+  {
+    retVal += left[i] * right[i];
+  }
+  return retVal;
+}
+
+
+#endif
\ No newline at end of file